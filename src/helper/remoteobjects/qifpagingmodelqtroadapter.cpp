@@ -2,18 +2,82 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qifpagingmodelqtroadapter_p.h"
+#include "qifremoteobjectshelper.h"
+#include "qifremoteobjectspendingresult_p.h"
 
 QT_BEGIN_NAMESPACE
 
+QIfPagingModelInstanceQtRoSource::QIfPagingModelInstanceQtRoSource(const QUuid &identifier, QIfPagingModelQtRoAdapter *adapter)
+    : QIfPagingModelInstanceSource(adapter)
+    , m_identifier(identifier)
+    , m_adapter(adapter)
+{
+}
+
+void QIfPagingModelInstanceQtRoSource::keepAlive()
+{
+    m_adapter->renewInstance(m_identifier);
+}
+
+/*!
+    \class QIfPagingModelQtRoAdapter
+    \internal
+
+    Remotes a QIfPagingModelInterface using the QIfPagingModel source.
+
+    In addition to the shared source, every registered instance gets its own
+    QIfPagingModelInstance source, which is remoted using
+    QIfRemoteObjectsHelper::instanceLookupName(). Once the replica of the client which registered
+    the instance has called keepAlive() on it, all updates for this identifier are only sent to
+    this client instead of being broadcasted to every client. Updates for the global QUuid() are
+    always broadcasted using the shared source.
+
+    The client needs to call keepAlive() at least once within instanceLeaseTimeout(). Otherwise
+    the client is considered to be gone, e.g. because it crashed or lost its connection, and the
+    instance is unregistered from the backend. Instance sources of clients which never called
+    keepAlive() are removed as well, but the instance stays registered, as such a client doesn't
+    support the instance sources and relies on the broadcasted updates.
+
+    The instance sources can only be remoted if the adapter was remoted using enableRemoting().
+*/
 QIfPagingModelQtRoAdapter::QIfPagingModelQtRoAdapter(const QString &remoteObjectsLookupName, QIfPagingModelInterface *parent)
     : QIfPagingModelSource(parent)
     , m_remoteObjectsLookupName(remoteObjectsLookupName)
     , m_backend(parent)
+    , m_instanceLeaseTimeout(3 * QIfRemoteObjectsHelper::instanceKeepAliveInterval)
+{
+    m_leaseTimer.setTimerType(Qt::CoarseTimer);
+    connect(&m_leaseTimer, &QTimer::timeout, this, &QIfPagingModelQtRoAdapter::checkInstanceLeases);
+
+    connect(m_backend, &QIfPagingModelInterface::supportedCapabilitiesChanged, this, [this](const QUuid &identifier, QtInterfaceFrameworkModule::ModelCapabilities capabilities) {
+        if (auto source = connectedInstanceSource(identifier))
+            Q_EMIT source->supportedCapabilitiesChanged(identifier, capabilities);
+        else
+            Q_EMIT supportedCapabilitiesChanged(identifier, capabilities);
+    });
+    connect(m_backend, &QIfPagingModelInterface::countChanged, this, [this](const QUuid &identifier, int newLength) {
+        if (auto source = connectedInstanceSource(identifier))
+            Q_EMIT source->countChanged(identifier, newLength);
+        else
+            Q_EMIT countChanged(identifier, newLength);
+    });
+    connect(m_backend, &QIfPagingModelInterface::dataFetched, this, [this](const QUuid &identifier, const QList<QVariant> &data, int start, bool moreAvailable) {
+        if (auto source = connectedInstanceSource(identifier))
+            Q_EMIT source->dataFetched(identifier, data, start, moreAvailable);
+        else
+            Q_EMIT dataFetched(identifier, data, start, moreAvailable);
+    });
+    connect(m_backend, &QIfPagingModelInterface::dataChanged, this, [this](const QUuid &identifier, const QList<QVariant> &data, int start, int count) {
+        if (auto source = connectedInstanceSource(identifier))
+            Q_EMIT source->dataChanged(identifier, data, start, count);
+        else
+            Q_EMIT dataChanged(identifier, data, start, count);
+    });
+}
+
+QIfPagingModelQtRoAdapter::~QIfPagingModelQtRoAdapter()
 {
-    connect(m_backend, &QIfPagingModelInterface::supportedCapabilitiesChanged, this, &QIfPagingModelQtRoAdapter::supportedCapabilitiesChanged);
-    connect(m_backend, &QIfPagingModelInterface::countChanged, this, &QIfPagingModelQtRoAdapter::countChanged);
-    connect(m_backend, &QIfPagingModelInterface::dataFetched, this, &QIfPagingModelQtRoAdapter::dataFetched);
-    connect(m_backend, &QIfPagingModelInterface::dataChanged, this, &QIfPagingModelQtRoAdapter::dataChanged);
+    disableRemoting();
 }
 
 QString QIfPagingModelQtRoAdapter::remoteObjectsLookupName() const
@@ -21,14 +85,85 @@ QString QIfPagingModelQtRoAdapter::remoteObjectsLookupName() const
     return m_remoteObjectsLookupName;
 }
 
+/*!
+    Enables the remoting of this adapter and all instance sources created later on using \a node.
+*/
+void QIfPagingModelQtRoAdapter::enableRemoting(QRemoteObjectHostBase *node)
+{
+    Q_ASSERT(!m_node);
+    m_node = node;
+    m_node->enableRemoting<QIfPagingModelAddressWrapper>(this);
+}
+
+/*!
+    Disables the remoting of this adapter and removes all instance sources.
+*/
+void QIfPagingModelQtRoAdapter::disableRemoting()
+{
+    if (!m_node)
+        return;
+
+    const auto identifiers = m_instanceSources.keys();
+    for (const QUuid &identifier : identifiers)
+        removeInstanceSource(identifier);
+
+    m_node->disableRemoting(this);
+    m_node = nullptr;
+}
+
+/*!
+    Returns the time in milliseconds in which a client needs to call keepAlive() on its instance
+    source, before the instance is removed.
+*/
+int QIfPagingModelQtRoAdapter::instanceLeaseTimeout() const
+{
+    return m_instanceLeaseTimeout;
+}
+
+void QIfPagingModelQtRoAdapter::setInstanceLeaseTimeout(int msecs)
+{
+    m_instanceLeaseTimeout = msecs;
+    for (InstanceSource &instance : m_instanceSources)
+        instance.lease = QDeadlineTimer(m_instanceLeaseTimeout);
+    if (m_leaseTimer.isActive())
+        m_leaseTimer.start(qMax(10, m_instanceLeaseTimeout / 2));
+}
+
+int QIfPagingModelQtRoAdapter::instanceSourceCount() const
+{
+    return int(m_instanceSources.size());
+}
+
 void QIfPagingModelQtRoAdapter::registerInstance(const QUuid &identifier)
 {
+    // The instance source needs to be available before the backend is informed, to allow the
+    // replica to connect as early as possible. Until the replica has connected, all updates are
+    // still broadcasted.
+    if (!m_node) {
+        if (!m_remotingWarningShown) {
+            qCWarning(qtif_private::qLcQtIfRoHelper) << m_remoteObjectsLookupName << "wasn't remoted using "
+                "QIfPagingModelQtRoAdapter::enableRemoting(). The updates of all model instances are "
+                "broadcasted to all clients.";
+            m_remotingWarningShown = true;
+        }
+    } else if (!identifier.isNull() && !m_instanceSources.contains(identifier)) {
+        auto source = new QIfPagingModelInstanceQtRoSource(identifier, this);
+        if (m_node->enableRemoting(source, QIfRemoteObjectsHelper::instanceLookupName(m_remoteObjectsLookupName, identifier))) {
+            m_instanceSources.insert(identifier, { source, false, QDeadlineTimer(m_instanceLeaseTimeout) });
+            if (!m_leaseTimer.isActive())
+                m_leaseTimer.start(qMax(10, m_instanceLeaseTimeout / 2));
+        } else {
+            delete source;
+        }
+    }
+
     m_backend->registerInstance(identifier);
 }
 
 void QIfPagingModelQtRoAdapter::unregisterInstance(const QUuid &identifier)
 {
     m_backend->unregisterInstance(identifier);
+    removeInstanceSource(identifier);
 }
 
 void QIfPagingModelQtRoAdapter::fetchData(const QUuid &identifier, int start, int count)
@@ -36,6 +171,66 @@ void QIfPagingModelQtRoAdapter::fetchData(const QUuid &identifier, int start, in
     m_backend->fetchData(identifier, start, count);
 }
 
+QIfPagingModelInstanceQtRoSource *QIfPagingModelQtRoAdapter::connectedInstanceSource(const QUuid &identifier) const
+{
+    if (identifier.isNull())
+        return nullptr;
+
+    const auto it = m_instanceSources.constFind(identifier);
+    if (it == m_instanceSources.cend() || !it->connected)
+        return nullptr;
+    return it->source;
+}
+
+void QIfPagingModelQtRoAdapter::removeInstanceSource(const QUuid &identifier)
+{
+    const InstanceSource instance = m_instanceSources.take(identifier);
+    if (!instance.source)
+        return;
+
+    if (m_node)
+        m_node->disableRemoting(instance.source);
+    delete instance.source;
+
+    if (m_instanceSources.isEmpty())
+        m_leaseTimer.stop();
+}
+
+/*
+    Called whenever the replica of \a identifier calls keepAlive(). The first call means that the
+    replica is connected, so all updates for \a identifier are only sent to its instance source
+    from now on.
+*/
+void QIfPagingModelQtRoAdapter::renewInstance(const QUuid &identifier)
+{
+    auto it = m_instanceSources.find(identifier);
+    if (it == m_instanceSources.end())
+        return;
+    it->connected = true;
+    it->lease = QDeadlineTimer(m_instanceLeaseTimeout);
+}
+
+void QIfPagingModelQtRoAdapter::checkInstanceLeases()
+{
+    QList<QUuid> expired;
+    for (auto it = m_instanceSources.cbegin(); it != m_instanceSources.cend(); ++it) {
+        if (it->lease.hasExpired())
+            expired.append(it.key());
+    }
+
+    for (const QUuid &identifier : std::as_const(expired)) {
+        const bool connected = m_instanceSources.value(identifier).connected;
+        removeInstanceSource(identifier);
+        // A client which never connected to its instance source still relies on the
+        // broadcasted updates, but a connected client which stopped calling keepAlive() is gone
+        if (connected) {
+            qCDebug(qtif_private::qLcQtIfRoHelper) << "The client of instance" << identifier << "of"
+                                                   << m_remoteObjectsLookupName << "is gone. Unregistering it.";
+            m_backend->unregisterInstance(identifier);
+        }
+    }
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qifpagingmodelqtroadapter_p.cpp"
@@ -16,6 +16,11 @@
 //
 
 #include <QtInterfaceFramework/QIfPagingModelInterface>
+#include <QtCore/QDeadlineTimer>
+#include <QtCore/QHash>
+#include <QtCore/QTimer>
+#include <QtCore/QUuid>
+#include <QtRemoteObjects/QRemoteObjectNode>
 #include "rep_qifpagingmodel_source.h"
 
 #include "qtifremoteobjectshelper_global.h"
@@ -29,6 +34,23 @@ struct QIfPagingModelAddressWrapper: public QIfPagingModelSourceAPI<ObjectType>
     {}
 };
 
+class QIfPagingModelQtRoAdapter;
+
+class QIfPagingModelInstanceQtRoSource : public QIfPagingModelInstanceSource
+{
+    Q_OBJECT
+
+public:
+    QIfPagingModelInstanceQtRoSource(const QUuid &identifier, QIfPagingModelQtRoAdapter *adapter);
+
+public Q_SLOTS:
+    void keepAlive() override;
+
+private:
+    QUuid m_identifier;
+    QIfPagingModelQtRoAdapter *m_adapter;
+};
+
 class Q_IFREMOTEOBJECTSHELPER_EXPORT QIfPagingModelQtRoAdapter : public QIfPagingModelSource
 {
     Q_OBJECT
@@ -36,16 +58,43 @@ class Q_IFREMOTEOBJECTSHELPER_EXPORT QIfPagingModelQtRoAdapter : public QIfPagin
 public:
     explicit QIfPagingModelQtRoAdapter(const QString &remoteObjectsLookupName, QIfPagingModelInterface *parent = nullptr);
 
+    ~QIfPagingModelQtRoAdapter() override;
+
     QString remoteObjectsLookupName() const;
 
+    void enableRemoting(QRemoteObjectHostBase *node);
+    void disableRemoting();
+
+    int instanceLeaseTimeout() const;
+    void setInstanceLeaseTimeout(int msecs);
+    int instanceSourceCount() const;
+
 public Q_SLOTS:
     void registerInstance(const QUuid &identifier) override;
     void unregisterInstance(const QUuid &identifier) override;
     void fetchData(const QUuid &identifier, int start, int count) override;
 
 private:
+    struct InstanceSource {
+        QIfPagingModelInstanceQtRoSource *source = nullptr;
+        bool connected = false;
+        QDeadlineTimer lease;
+    };
+
+    QIfPagingModelInstanceQtRoSource *connectedInstanceSource(const QUuid &identifier) const;
+    void removeInstanceSource(const QUuid &identifier);
+    void renewInstance(const QUuid &identifier);
+    void checkInstanceLeases();
+
     QString m_remoteObjectsLookupName;
     QIfPagingModelInterface *m_backend;
+    QRemoteObjectHostBase *m_node = nullptr;
+    QHash<QUuid, InstanceSource> m_instanceSources;
+    int m_instanceLeaseTimeout;
+    QTimer m_leaseTimer;
+    bool m_remotingWarningShown = false;
+
+    friend class QIfPagingModelInstanceQtRoSource;
 };
 
 QT_END_NAMESPACE
@@ -139,6 +139,20 @@ bool QIfRemoteObjectsConfig::reportErrorsOnStdErr() const
     The url is specific to the provided \a module and \a interface arguments and can be modified
     using the \l setDefaultServerUrl() function or by using one of the config files.
 
+    See url() for how the url is resolved.
+
+    \sa host
+*/
+QRemoteObjectHost *QIfRemoteObjectsConfig::host(const QString &module, const QString &interface, const QUrl &fallbackUrl)
+{
+    return host(url(module, interface, fallbackUrl));
+}
+
+/*!
+    \since 6.9
+
+    Returns the url which is used for the provided \a module and \a interface arguments.
+
     If multiple values are configured the urls are resolved in the following order:
     \list numbered
         \li interface
@@ -153,7 +167,7 @@ bool QIfRemoteObjectsConfig::reportErrorsOnStdErr() const
 
     \sa host
 */
-QRemoteObjectHost *QIfRemoteObjectsConfig::host(const QString &module, const QString &interface, const QUrl &fallbackUrl)
+QUrl QIfRemoteObjectsConfig::url(const QString &module, const QString &interface, const QUrl &fallbackUrl)
 {
     QUrl url;
     if (m_settings) {
@@ -161,13 +175,13 @@ QRemoteObjectHost *QIfRemoteObjectsConfig::host(const QString &module, const QSt
         url = m_settings->value(u"connectionUrl").toUrl();
         m_settings->endGroup();
         if (url.isValid())
-            return host(url);
+            return url;
 
         m_settings->beginGroup(module);
         url = m_settings->value(u"connectionUrl").toUrl();
         m_settings->endGroup();
         if (url.isValid())
-            return host(url);
+            return url;
 
         // Debug registry is deprecated please use the serverUrl instead.
         if (m_settings->contains(u"Registry")) {
@@ -178,21 +192,21 @@ QRemoteObjectHost *QIfRemoteObjectsConfig::host(const QString &module, const QSt
             url = m_settings->value(u"Registry").toUrl();
         }
         if (url.isValid())
-            return host(url);
+            return url;
 
     }
 
     // No settings for the interface/module were provided
     // Use the defaultServer if that is set
     if (m_defaultServer.isValid())
-        return host(m_defaultServer);
+        return m_defaultServer;
 
     // If valid use fallback URL
     if (fallbackUrl.isValid())
-        return host(fallbackUrl);
+        return fallbackUrl;
 
     // Create default url (using localsockets) for the module
-    return host(QUrl(QIfRemoteObjectsHelper::buildDefaultUrl(module.split(u'.').last().toLower())));
+    return QUrl(QIfRemoteObjectsHelper::buildDefaultUrl(module.split(u'.').last().toLower()));
 }
 
 /*!
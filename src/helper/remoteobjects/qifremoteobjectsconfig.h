@@ -27,6 +27,7 @@ public:
 
     QRemoteObjectHost *host(const QString &module, const QString &interface, const QUrl &fallbackUrl = QUrl());
     QRemoteObjectHost *host(const QUrl &url);
+    QUrl url(const QString &module, const QString &interface, const QUrl &fallbackUrl = QUrl());
 
     // pass object as the first argument to be similar to the qtro enableRemoting ?
     bool enableRemoting(const QString &module, const QString &interface, const QUrl &fallbackUrl, QObject *object);
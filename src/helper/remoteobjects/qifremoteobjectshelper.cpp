@@ -3,10 +3,29 @@
 
 #include "qifremoteobjectshelper.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
+
 QT_BEGIN_NAMESPACE
 
 using namespace Qt::Literals::StringLiterals;
 
+namespace {
+
+// QObjects can't be shared across threads, which is why the nodes are registered per thread
+using NodeKey = std::pair<QThread *, QUrl>;
+
+struct NodeRegistry
+{
+    QMutex mutex;
+    QHash<NodeKey, QWeakPointer<QRemoteObjectNode>> nodes;
+};
+
+Q_GLOBAL_STATIC(NodeRegistry, nodeRegistry)
+
+} // namespace
+
 /*!
     \namespace QIfRemoteObjectsHelper
     \inmodule QtIfRemoteObjectsHelper
@@ -36,6 +55,62 @@ QString buildDefaultUrl(const QString &url)
 #endif
 }
 
+/*!
+    \since 6.9
+
+    Returns a QRemoteObjectNode which is connected to \a url.
+
+    All callers within the same thread share a single node for every url, which avoids opening a
+    separate connection to the same server for every replica. The node is destroyed once the last
+    QSharedPointer referencing it is released.
+
+    Returns a null pointer if the connection to \a url could not be established.
+*/
+QSharedPointer<QRemoteObjectNode> acquireNode(const QUrl &url)
+{
+    const NodeKey key(QThread::currentThread(), url);
+    NodeRegistry *registry = nodeRegistry();
+
+    QMutexLocker locker(&registry->mutex);
+    QSharedPointer<QRemoteObjectNode> node = registry->nodes.value(key).toStrongRef();
+    if (node)
+        return node;
+
+    auto rawNode = new QRemoteObjectNode();
+    if (!rawNode->connectToNode(url)) {
+        delete rawNode;
+        return {};
+    }
+
+    node = QSharedPointer<QRemoteObjectNode>(rawNode, [key](QRemoteObjectNode *nodeToDelete) {
+        if (!nodeRegistry.isDestroyed()) {
+            NodeRegistry *registry = nodeRegistry();
+            QMutexLocker locker(&registry->mutex);
+            // The entry might already be replaced by a new node for the same url
+            auto it = registry->nodes.find(key);
+            if (it != registry->nodes.end() && !it->toStrongRef())
+                registry->nodes.erase(it);
+        }
+        delete nodeToDelete;
+    });
+    registry->nodes.insert(key, node);
+    return node;
+}
+
+/*!
+    \since 6.9
+
+    Returns the lookup name of the source which delivers all updates for the model instance
+    \a identifier, which is remoted by the paging model using \a remoteObjectsLookupName.
+
+    Updates for a registered instance are only sent to the client which has acquired a replica
+    for this name, instead of being broadcasted to all clients.
+*/
+QString instanceLookupName(const QString &remoteObjectsLookupName, const QUuid &identifier)
+{
+    return remoteObjectsLookupName + u'/' + identifier.toString(QUuid::WithoutBraces);
+}
+
 } // namespace QIfRemoteObjectsHelper
 
 QT_END_NAMESPACE
@@ -6,6 +6,10 @@
 
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QUrl>
+#include <QtCore/QUuid>
+#include <QtRemoteObjects/QRemoteObjectNode>
 
 #include <QtIfRemoteObjectsHelper/qtifremoteobjectshelper_global.h>
 
@@ -13,7 +17,12 @@ QT_BEGIN_NAMESPACE
 
 namespace QIfRemoteObjectsHelper {
 
+// The interval in which a client calls keepAlive() on the instance sources it is connected to
+constexpr int instanceKeepAliveInterval = 10000;
+
 Q_IFREMOTEOBJECTSHELPER_EXPORT QString buildDefaultUrl(const QString &url);
+Q_IFREMOTEOBJECTSHELPER_EXPORT QSharedPointer<QRemoteObjectNode> acquireNode(const QUrl &url);
+Q_IFREMOTEOBJECTSHELPER_EXPORT QString instanceLookupName(const QString &remoteObjectsLookupName, const QUuid &identifier);
 
 } // namespace QIfRemoteObjectsHelper
 
@@ -0,0 +1,183 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qifremoteobjectslazyhost_p.h"
+#include "qifremoteobjectspendingresult_p.h"
+
+#include <QtNetwork/QHostInfo>
+#include <QtNetwork/QLocalServer>
+#include <QtNetwork/QLocalSocket>
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+
+QT_BEGIN_NAMESPACE
+
+using namespace Qt::StringLiterals;
+
+/*!
+    \class QIfRemoteObjectsLazyHost
+    \internal
+
+    A QRemoteObjectHost which creates its sources once the first client connects.
+
+    QtRO serializes the initial property values of a source when a replica acquires it, which
+    means all the objects the source needs to answer need to exist before the source is remoted.
+    To defer the creation of expensive sources (e.g. a backend including its simulation), the
+    lazy host listens on the \l url itself and hands every incoming connection to a QRemoteObjectHost
+    without a url using QRemoteObjectHostBase::addHostSideConnection().
+
+    Before the first connection is handed over, all source factories added with
+    addSourceFactory() are called. They are expected to create their sources and enable the
+    remoting on the passed node. The connected replicas are informed about the new sources and
+    acquire them like any other source.
+
+    The \c local, \c localabstract and \c tcp schemes are supported.
+*/
+
+QIfRemoteObjectsLazyHost::QIfRemoteObjectsLazyHost(const QUrl &url, QObject *parent)
+    : QObject(parent)
+    , m_url(url)
+    , m_host(new QRemoteObjectHost(this))
+{
+}
+
+QIfRemoteObjectsLazyHost::~QIfRemoteObjectsLazyHost() = default;
+
+/*!
+    Returns the url the host listens on.
+*/
+QUrl QIfRemoteObjectsLazyHost::url() const
+{
+    return m_url;
+}
+
+/*!
+    Returns the QRemoteObjectHost all incoming connections are handed to.
+*/
+QRemoteObjectHost *QIfRemoteObjectsLazyHost::host() const
+{
+    return m_host;
+}
+
+/*!
+    Starts listening on the \l url. Returns \c true on success, otherwise \c false and the reason
+    is available using errorString().
+*/
+bool QIfRemoteObjectsLazyHost::listen()
+{
+    if (isListening())
+        return true;
+
+    const QString scheme = m_url.scheme();
+    if (scheme == u"local"_s || scheme == u"localabstract"_s) {
+        m_localServer = new QLocalServer(this);
+        if (scheme == u"localabstract"_s)
+            m_localServer->setSocketOptions(QLocalServer::AbstractNamespaceOption);
+        connect(m_localServer, &QLocalServer::newConnection, this, [this]() {
+            while (QLocalSocket *socket = m_localServer->nextPendingConnection())
+                addConnection(socket);
+        });
+
+        // Same as QtRO: a crashed server might have left the socket file behind
+        bool listening = m_localServer->listen(m_url.path());
+        if (!listening && scheme == u"local"_s) {
+            QLocalServer::removeServer(m_url.path());
+            listening = m_localServer->listen(m_url.path());
+        }
+        if (!listening) {
+            m_errorString = m_localServer->errorString();
+            delete m_localServer;
+            m_localServer = nullptr;
+            return false;
+        }
+    } else if (scheme == u"tcp"_s) {
+        QHostAddress address(m_url.host());
+        if (address.isNull()) {
+            const QList<QHostAddress> addresses = QHostInfo::fromName(m_url.host()).addresses();
+            if (!addresses.isEmpty())
+                address = addresses.first();
+        }
+
+        m_tcpServer = new QTcpServer(this);
+        connect(m_tcpServer, &QTcpServer::newConnection, this, [this]() {
+            while (QTcpSocket *socket = m_tcpServer->nextPendingConnection())
+                addConnection(socket);
+        });
+        if (!m_tcpServer->listen(address, quint16(m_url.port()))) {
+            m_errorString = m_tcpServer->errorString();
+            delete m_tcpServer;
+            m_tcpServer = nullptr;
+            return false;
+        }
+    } else {
+        m_errorString = u"The scheme '%1' is not supported"_s.arg(scheme);
+        return false;
+    }
+
+    qCDebug(qtif_private::qLcQtIfRoHelper) << "Listening lazily on" << m_url;
+    m_errorString.clear();
+    return true;
+}
+
+/*!
+    Returns \c true if the host is listening for connections.
+*/
+bool QIfRemoteObjectsLazyHost::isListening() const
+{
+    return m_localServer || m_tcpServer;
+}
+
+/*!
+    Returns a human readable description of the last error which occurred in listen().
+*/
+QString QIfRemoteObjectsLazyHost::errorString() const
+{
+    return m_errorString;
+}
+
+/*!
+    Adds a \a factory which is called before the first connection is handed to the host.
+
+    If the sources were already created, \a factory is called right away.
+*/
+void QIfRemoteObjectsLazyHost::addSourceFactory(const SourceFactory &factory)
+{
+    if (m_sourcesCreated) {
+        factory(m_host);
+        return;
+    }
+    m_sourceFactories.append(factory);
+}
+
+/*!
+    Returns \c true once the source factories have been called.
+*/
+bool QIfRemoteObjectsLazyHost::sourcesCreated() const
+{
+    return m_sourcesCreated;
+}
+
+void QIfRemoteObjectsLazyHost::addConnection(QIODevice *connection)
+{
+    if (auto localSocket = qobject_cast<QLocalSocket *>(connection))
+        connect(localSocket, &QLocalSocket::disconnected, localSocket, &QObject::deleteLater);
+    else if (auto tcpSocket = qobject_cast<QAbstractSocket *>(connection))
+        connect(tcpSocket, &QAbstractSocket::disconnected, tcpSocket, &QObject::deleteLater);
+
+    // The host needs a connection before it is able to remote any source. The connected replica
+    // gets informed about all sources remoted afterwards.
+    m_host->addHostSideConnection(connection);
+
+    if (m_sourcesCreated)
+        return;
+
+    m_sourcesCreated = true;
+    qCDebug(qtif_private::qLcQtIfRoHelper) << "First connection on" << m_url << "creating the sources";
+    const QList<SourceFactory> factories = std::exchange(m_sourceFactories, {});
+    for (const SourceFactory &factory : factories)
+        factory(m_host);
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qifremoteobjectslazyhost_p.cpp"
@@ -0,0 +1,69 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIFREMOTEOBJECTSLAZYHOST_P_H
+#define QIFREMOTEOBJECTSLAZYHOST_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QUrl>
+#include <QtRemoteObjects/QRemoteObjectHost>
+
+#include "qtifremoteobjectshelper_global.h"
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+class QLocalServer;
+class QTcpServer;
+
+class Q_IFREMOTEOBJECTSHELPER_EXPORT QIfRemoteObjectsLazyHost : public QObject
+{
+    Q_OBJECT
+
+public:
+    using SourceFactory = std::function<void(QRemoteObjectHostBase *node)>;
+
+    explicit QIfRemoteObjectsLazyHost(const QUrl &url, QObject *parent = nullptr);
+    ~QIfRemoteObjectsLazyHost() override;
+
+    QUrl url() const;
+    QRemoteObjectHost *host() const;
+
+    bool listen();
+    bool isListening() const;
+    QString errorString() const;
+
+    void addSourceFactory(const SourceFactory &factory);
+    bool sourcesCreated() const;
+
+private:
+    void addConnection(QIODevice *connection);
+
+    QUrl m_url;
+    QRemoteObjectHost *m_host;
+    QLocalServer *m_localServer = nullptr;
+    QTcpServer *m_tcpServer = nullptr;
+    QString m_errorString;
+    QList<SourceFactory> m_sourceFactories;
+    bool m_sourcesCreated = false;
+
+    Q_DISABLE_COPY_MOVE(QIfRemoteObjectsLazyHost)
+};
+
+QT_END_NAMESPACE
+
+#endif // QIFREMOTEOBJECTSLAZYHOST_P_H
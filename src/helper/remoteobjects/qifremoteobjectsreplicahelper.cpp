@@ -4,15 +4,120 @@
 
 #include "qifremoteobjectsreplicahelper_p.h"
 
+#include <algorithm>
+
 using namespace Qt::StringLiterals;
 
 QT_BEGIN_NAMESPACE
 
+namespace {
+    constexpr int defaultMaximumPendingReplies = 1024;
+}
+
 QIfRemoteObjectsReplicaHelper::QIfRemoteObjectsReplicaHelper(const QLoggingCategory &category, QObject *parent)
     : QObject(parent)
     , m_category(category)
+    , m_maximumPendingReplies(defaultMaximumPendingReplies)
 {
     qRegisterMetaType<QIfRemoteObjectsPendingResult>();
+
+    m_timeoutTimer.setTimerType(Qt::CoarseTimer);
+    connect(&m_timeoutTimer, &QTimer::timeout, this, &QIfRemoteObjectsReplicaHelper::checkTimeouts);
+}
+
+/*
+    Reads the settings for the remote calls from \a settings.
+
+    Every setting is first searched in the maps stored for the keys in \a lookupKeys, e.g. the
+    interface name, before the global value is used. The following settings are supported:
+
+    \list
+        \li callTimeout: The time in milliseconds after which a call without an answer fails.
+            Defaults to -1, which means that calls never time out.
+        \li maximumPendingReplies: The number of calls which can wait for an answer at the same
+            time. If more calls are made, the oldest pending call fails. Defaults to 1024, a value
+            of -1 disables the limit.
+    \endlist
+*/
+void QIfRemoteObjectsReplicaHelper::applyServiceSettings(const QVariantMap &settings, const QStringList &lookupKeys)
+{
+    auto findSetting = [&settings, &lookupKeys](const QString &name) -> QVariant {
+        for (const QString &key : lookupKeys) {
+            const QVariantMap keySettings = settings.value(key).toMap();
+            const auto it = keySettings.constFind(name);
+            if (it != keySettings.constEnd())
+                return *it;
+        }
+        return settings.value(name);
+    };
+
+    const QVariant callTimeout = findSetting(u"callTimeout"_s);
+    setCallTimeout(callTimeout.isValid() ? callTimeout.toInt() : -1);
+    const QVariant maximumPendingReplies = findSetting(u"maximumPendingReplies"_s);
+    setMaximumPendingReplies(maximumPendingReplies.isValid() ? maximumPendingReplies.toInt() : defaultMaximumPendingReplies);
+}
+
+int QIfRemoteObjectsReplicaHelper::callTimeout() const
+{
+    return m_callTimeout;
+}
+
+/*
+    Sets the timeout for all following calls to \a msecs. A value of -1 disables the timeout.
+*/
+void QIfRemoteObjectsReplicaHelper::setCallTimeout(int msecs)
+{
+    m_callTimeout = msecs;
+    updateTimeoutTimer();
+}
+
+int QIfRemoteObjectsReplicaHelper::maximumPendingReplies() const
+{
+    return m_maximumPendingReplies;
+}
+
+void QIfRemoteObjectsReplicaHelper::setMaximumPendingReplies(int maximum)
+{
+    m_maximumPendingReplies = maximum;
+}
+
+int QIfRemoteObjectsReplicaHelper::pendingReplyCount() const
+{
+    return int(m_pendingCalls.size() + m_pendingReplies.size());
+}
+
+quint64 QIfRemoteObjectsReplicaHelper::timedOutReplyCount() const
+{
+    return m_timedOutReplyCount;
+}
+
+quint64 QIfRemoteObjectsReplicaHelper::droppedReplyCount() const
+{
+    return m_droppedReplyCount;
+}
+
+/*
+    Lets all calls fail which are still waiting for an answer.
+*/
+void QIfRemoteObjectsReplicaHelper::failPendingReplies()
+{
+    // Failing a reply can trigger new calls, so the tables are cleared first
+    const auto pendingCalls = std::exchange(m_pendingCalls, {});
+    const auto pendingReplies = std::exchange(m_pendingReplies, {});
+    updateTimeoutTimer();
+
+    if (!pendingCalls.isEmpty() || !pendingReplies.isEmpty())
+        qCDebug(m_category) << "Failing" << pendingCalls.size() + pendingReplies.size() << "pending replies";
+
+    for (auto it = pendingCalls.cbegin(); it != pendingCalls.cend(); ++it) {
+        it.key()->deleteLater();
+        QIfPendingReplyBase reply = it->reply;
+        reply.setFailed();
+    }
+    for (const PendingReply &pending : pendingReplies) {
+        QIfPendingReplyBase reply = pending.reply;
+        reply.setFailed();
+    }
 }
 
 QVariant QIfRemoteObjectsReplicaHelper::fromRemoteObjectVariant(const QVariant &variant) const
@@ -28,7 +133,8 @@ void QIfRemoteObjectsReplicaHelper::onPendingResultAvailable(quint64 id, bool is
         return;
     }
 
-    QIfPendingReplyBase ifReply = m_pendingReplies.take(id);
+    QIfPendingReplyBase ifReply = m_pendingReplies.take(id).reply;
+    updateTimeoutTimer();
 
     if (isSuccess)
         ifReply.setSuccess(value);
@@ -42,6 +148,8 @@ void QIfRemoteObjectsReplicaHelper::onReplicaStateChanged(QRemoteObjectReplica::
 
     if (newState == QRemoteObjectReplica::Suspect) {
         qCWarning(m_category) << "QRemoteObjectReplica error, connection to the source lost";
+        // The answers to the outstanding calls will never arrive
+        failPendingReplies();
         emit errorChanged(QIfAbstractFeature::Unknown,
                           u"QRemoteObjectReplica error, connection to the source lost"_s);
     } else if (newState == QRemoteObjectReplica::SignatureMismatch) {
@@ -60,6 +168,129 @@ void QIfRemoteObjectsReplicaHelper::onNodeError(QRemoteObjectNode::ErrorCode cod
     emit errorChanged(QIfAbstractFeature::Unknown, u"QRemoteObjectNode error, code: "_s + QLatin1String(metaEnum.valueToKey(code)));
 }
 
+void QIfRemoteObjectsReplicaHelper::checkTimeouts()
+{
+    QList<QIfPendingReplyBase> expired;
+    for (auto it = m_pendingCalls.begin(); it != m_pendingCalls.end();) {
+        if (it->deadline.hasExpired()) {
+            it.key()->deleteLater();
+            expired.append(it->reply);
+            it = m_pendingCalls.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = m_pendingReplies.begin(); it != m_pendingReplies.end();) {
+        if (it->deadline.hasExpired()) {
+            qCDebug(m_category) << "Pending Result with id:" << it.key() << "timed out";
+            expired.append(it->reply);
+            it = m_pendingReplies.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    updateTimeoutTimer();
+
+    if (expired.isEmpty())
+        return;
+
+    m_timedOutReplyCount += expired.size();
+    qCWarning(m_category) << expired.size() << "remote calls didn't finish within" << m_callTimeout << "ms";
+    for (QIfPendingReplyBase &reply : expired)
+        reply.setFailed();
+}
+
+void QIfRemoteObjectsReplicaHelper::addPendingCall(QRemoteObjectPendingCallWatcher *watcher, const QIfPendingReplyBase &reply)
+{
+    ensureCapacity();
+    m_pendingCalls.insert(watcher, createPendingReply(reply));
+    updateTimeoutTimer();
+}
+
+void QIfRemoteObjectsReplicaHelper::onPendingCallFinished(QRemoteObjectPendingCallWatcher *watcher)
+{
+    watcher->deleteLater();
+    // The call might have failed already, because of a timeout or a lost connection
+    auto it = m_pendingCalls.find(watcher);
+    if (it == m_pendingCalls.end())
+        return;
+    PendingReply pending = std::move(*it);
+    m_pendingCalls.erase(it);
+
+    QIfPendingReplyBase &ifReply = pending.reply;
+    if (watcher->error() == QRemoteObjectPendingCallWatcher::NoError) {
+        QVariant value = watcher->returnValue();
+        if (value.canConvert<QIfRemoteObjectsPendingResult>()) {
+            auto result = value.value<QIfRemoteObjectsPendingResult>();
+            if (result.failed()) {
+                qCDebug(m_category) << "Pending Result with id:" << result.id() << "failed";
+                ifReply.setFailed();
+            } else {
+                qCDebug(m_category) << "Result not available yet. Waiting for id:" << result.id();
+                m_pendingReplies.insert(result.id(), pending);
+            }
+        } else {
+            qCDebug(m_category) << "Got the value right away:" << value;
+            ifReply.setSuccess(value);
+        }
+    } else {
+        ifReply.setFailed();
+    }
+    updateTimeoutTimer();
+}
+
+QIfRemoteObjectsReplicaHelper::PendingReply QIfRemoteObjectsReplicaHelper::createPendingReply(const QIfPendingReplyBase &reply)
+{
+    PendingReply pending;
+    pending.reply = reply;
+    pending.deadline = m_callTimeout >= 0 ? QDeadlineTimer(m_callTimeout) : QDeadlineTimer(QDeadlineTimer::Forever);
+    pending.sequence = m_sequence++;
+    return pending;
+}
+
+void QIfRemoteObjectsReplicaHelper::ensureCapacity()
+{
+    if (m_maximumPendingReplies < 0 || pendingReplyCount() < m_maximumPendingReplies)
+        return;
+
+    // Drop the oldest call to make room for a new one
+    auto oldestCall = std::min_element(m_pendingCalls.begin(), m_pendingCalls.end(), [](const PendingReply &a, const PendingReply &b) {
+        return a.sequence < b.sequence;
+    });
+    auto oldestReply = std::min_element(m_pendingReplies.begin(), m_pendingReplies.end(), [](const PendingReply &a, const PendingReply &b) {
+        return a.sequence < b.sequence;
+    });
+
+    QIfPendingReplyBase dropped;
+    if (oldestReply == m_pendingReplies.end()
+        || (oldestCall != m_pendingCalls.end() && oldestCall->sequence < oldestReply->sequence)) {
+        if (oldestCall == m_pendingCalls.end())
+            return;
+        oldestCall.key()->deleteLater();
+        dropped = oldestCall->reply;
+        m_pendingCalls.erase(oldestCall);
+    } else {
+        dropped = oldestReply->reply;
+        m_pendingReplies.erase(oldestReply);
+    }
+
+    ++m_droppedReplyCount;
+    qCWarning(m_category) << "More than" << m_maximumPendingReplies << "remote calls are pending. Dropping the oldest call.";
+    dropped.setFailed();
+}
+
+void QIfRemoteObjectsReplicaHelper::updateTimeoutTimer()
+{
+    if (m_callTimeout < 0 || (m_pendingCalls.isEmpty() && m_pendingReplies.isEmpty())) {
+        m_timeoutTimer.stop();
+        return;
+    }
+
+    // The timeouts are only checked periodically, which is precise enough for failing calls
+    if (!m_timeoutTimer.isActive())
+        m_timeoutTimer.start(qBound(10, m_callTimeout / 4, 1000));
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qifremoteobjectsreplicahelper_p.cpp"
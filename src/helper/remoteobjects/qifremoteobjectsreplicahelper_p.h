@@ -21,6 +21,8 @@
 #include <QtRemoteObjects/QRemoteObjectNode>
 #include <QtRemoteObjects/QRemoteObjectReplica>
 #include <QtRemoteObjects/QRemoteObjectPendingCall>
+#include <QtCore/QDeadlineTimer>
+#include <QtCore/QTimer>
 
 #include "qtifremoteobjectshelper_global.h"
 #include "qifremoteobjectspendingresult_p.h"
@@ -40,31 +42,25 @@ public:
     {
         qCDebug(m_category) << "Analyzing QRemoteObjectPendingCall";
         QIfPendingReply<T> ifReply;
-        auto watcher = new QRemoteObjectPendingCallWatcher(reply);
-        connect(watcher, &QRemoteObjectPendingCallWatcher::finished, watcher, [this, ifReply] (QRemoteObjectPendingCallWatcher *self) mutable {
-            if (self->error() == QRemoteObjectPendingCallWatcher::NoError) {
-                QVariant value = self->returnValue();
-                if (value.canConvert<QIfRemoteObjectsPendingResult>()) {
-                    auto result = value.value<QIfRemoteObjectsPendingResult>();
-                    if (result.failed()) {
-                        qCDebug(m_category) << "Pending Result with id:" << result.id() << "failed";
-                        ifReply.setFailed();
-                    } else {
-                        qCDebug(m_category) << "Result not available yet. Waiting for id:" << result.id();
-                        m_pendingReplies.insert(result.id(), ifReply);
-                    }
-                } else {
-                    qCDebug(m_category) << "Got the value right away:" << value;
-                    ifReply.setSuccess(value);
-                }
-            } else {
-                ifReply.setFailed();
-            }
-            self->deleteLater();
-        });
+        auto watcher = new QRemoteObjectPendingCallWatcher(reply, this);
+        addPendingCall(watcher, ifReply);
+        connect(watcher, &QRemoteObjectPendingCallWatcher::finished, this, &QIfRemoteObjectsReplicaHelper::onPendingCallFinished);
         return ifReply;
     }
 
+    void applyServiceSettings(const QVariantMap &settings, const QStringList &lookupKeys);
+
+    int callTimeout() const;
+    void setCallTimeout(int msecs);
+    int maximumPendingReplies() const;
+    void setMaximumPendingReplies(int maximum);
+
+    int pendingReplyCount() const;
+    quint64 timedOutReplyCount() const;
+    quint64 droppedReplyCount() const;
+
+    void failPendingReplies();
+
 public Q_SLOTS:
     void onPendingResultAvailable(quint64 id, bool isSuccess, const QVariant &value);
     void onReplicaStateChanged(QRemoteObjectReplica::State newState, QRemoteObjectReplica::State oldState);
@@ -74,8 +70,30 @@ Q_SIGNALS:
     void errorChanged(QIfAbstractFeature::Error error, const QString &message = QString());
 
 private:
-    QHash<quint64, QIfPendingReplyBase> m_pendingReplies;
+    struct PendingReply {
+        QIfPendingReplyBase reply;
+        QDeadlineTimer deadline;
+        quint64 sequence = 0;
+    };
+
+    void addPendingCall(QRemoteObjectPendingCallWatcher *watcher, const QIfPendingReplyBase &reply);
+    void onPendingCallFinished(QRemoteObjectPendingCallWatcher *watcher);
+    void checkTimeouts();
+    PendingReply createPendingReply(const QIfPendingReplyBase &reply);
+    void ensureCapacity();
+    void updateTimeoutTimer();
+
+    // Calls which are waiting for the QRemoteObjectPendingCall to finish
+    QHash<QRemoteObjectPendingCallWatcher *, PendingReply> m_pendingCalls;
+    // Calls which are waiting for the pendingResultAvailable signal
+    QHash<quint64, PendingReply> m_pendingReplies;
     const QLoggingCategory &m_category;
+    int m_callTimeout = -1;
+    int m_maximumPendingReplies;
+    quint64 m_sequence = 0;
+    quint64 m_timedOutReplyCount = 0;
+    quint64 m_droppedReplyCount = 0;
+    QTimer m_timeoutTimer;
 };
 
 QT_END_NAMESPACE
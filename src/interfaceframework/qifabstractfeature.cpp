@@ -49,6 +49,20 @@ void QIfAbstractFeaturePrivate::initialize()
 {
 }
 
+/*!
+    \internal Applies the property \a changes of \a zone, which the feature missed while its
+    backend updates were disabled.
+
+    Returns \c false if the feature can't apply the changes and needs to be initialized by
+    the backend instead, which is the default.
+*/
+bool QIfAbstractFeaturePrivate::applyPropertyChanges(const QVariantMap &changes, const QString &zone)
+{
+    Q_UNUSED(changes)
+    Q_UNUSED(zone)
+    return false;
+}
+
 /*!
     \internal Returns the backend object retrieved from calling interfaceInstance() with the
     interfaceName of this private class.
@@ -68,6 +82,27 @@ QIfFeatureInterface *QIfAbstractFeaturePrivate::backend() const
     return nullptr;
 }
 
+/*!
+    \internal
+
+    Returns the throttle used by generated property setters to limit the writes to the backend.
+    It is created on first use.
+*/
+QIfPropertyWriteThrottle *QIfAbstractFeaturePrivate::writeThrottle()
+{
+    Q_Q(QIfAbstractFeature);
+    if (!m_writeThrottle)
+        m_writeThrottle = new QIfPropertyWriteThrottle(q);
+    return m_writeThrottle;
+}
+
+void QIfAbstractFeaturePrivate::setPropertyWritePolicy(const QString &property, QIfPropertyWriteThrottle::Policy policy, int interval)
+{
+    if (!m_writeThrottle && policy == QIfPropertyWriteThrottle::Immediate)
+        return;
+    writeThrottle()->setPolicy(property, policy, interval);
+}
+
 QIfAbstractFeaturePrivate *QIfAbstractFeaturePrivate::get(QIfAbstractFeature *q)
 {
     return static_cast<QIfAbstractFeaturePrivate *>(q->d_ptr.data());
@@ -93,6 +128,31 @@ void QIfAbstractFeaturePrivate::onInitializationDone()
     emit q->isInitializedChanged(true);
 }
 
+/*!
+    \internal Catches up with the changes of \a backend since the backend updates were disabled.
+
+    Returns \c false if the feature needs to be initialized by the backend instead.
+*/
+bool QIfAbstractFeaturePrivate::resumeBackendUpdates(QIfFeatureInterface *backend)
+{
+    const bool paused = m_pausedBackend && m_pausedBackend == backend;
+    m_pausedBackend = nullptr;
+    if (!paused)
+        return false;
+
+    QHash<QString, QVariantMap> changes;
+    if (!backend->propertyChangesSince(m_pausedStateVersion, &changes))
+        return false;
+
+    for (auto it = changes.cbegin(); it != changes.cend(); ++it) {
+        if (!applyPropertyChanges(it.value(), it.key()))
+            return false;
+    }
+
+    onInitializationDone();
+    return true;
+}
+
 void QIfAbstractFeaturePrivate::serviceObjectDestroyed()
 {
     Q_Q(QIfAbstractFeature);
@@ -372,6 +432,11 @@ bool QIfAbstractFeature::setServiceObject(QIfServiceObject *so)
         QObjectPrivate::disconnect(d->m_serviceObject, &QObject::destroyed, d, &QIfAbstractFeaturePrivate::serviceObjectDestroyed);
     }
 
+    // Pending writes were meant for the old backend
+    if (d->m_writeThrottle)
+        d->m_writeThrottle->discard();
+    d->m_pausedBackend = nullptr;
+
     d->m_serviceObject = nullptr;
 
     //We only want to call clearServiceObject if we are sure that the serviceObject changes
@@ -651,6 +716,12 @@ void QIfAbstractFeature::setPreferredBackends(const QStringList &preferredBacken
 
     A change to this property will cause the connectToServiceObject() and disconnectFromServiceObject()
     functions to be called, depending on the new value.
+
+    Once the updates are enabled again, the backend is asked to report its complete state again.
+    If the backend tracks its property state (see
+    QIfFeatureInterface::setPropertyStateTrackingEnabled()), only the properties which changed
+    meanwhile are applied to this feature instead, without involving any other feature
+    connected to the same backend.
 */
 
 /*!
@@ -668,6 +739,12 @@ void QIfAbstractFeature::setPreferredBackends(const QStringList &preferredBacken
 
     A change to this property will cause the connectToServiceObject() and disconnectFromServiceObject()
     functions to be called, depending on the new value.
+
+    Once the updates are enabled again, the backend is asked to report its complete state again.
+    If the backend tracks its property state (see
+    QIfFeatureInterface::setPropertyStateTrackingEnabled()), only the properties which changed
+    meanwhile are applied to this feature instead, without involving any other feature
+    connected to the same backend.
 */
 bool QIfAbstractFeature::backendUpdatesEnabled() const
 {
@@ -682,10 +759,18 @@ void QIfAbstractFeature::setBackendUpdatesEnabled(bool newBackendUpdatesEnabled)
         return;
     d->m_backendUpdatesEnabled = newBackendUpdatesEnabled;
     if (d->m_serviceObject) {
-        if (d->m_backendUpdatesEnabled)
+        if (d->m_backendUpdatesEnabled) {
             connectToServiceObject(d->m_serviceObject);
-        else
+        } else {
+            // Remember the property state, to only catch up with the changes once resumed. This
+            // requires the feature to know the complete state already.
+            QIfFeatureInterface *backend = d->backend();
+            if (backend && d->m_isInitialized && backend->isPropertyStateTrackingEnabled()) {
+                d->m_pausedBackend = backend;
+                d->m_pausedStateVersion = backend->propertyStateVersion();
+            }
             disconnectFromServiceObject(d->m_serviceObject);
+        }
     }
     emit backendUpdatesEnabledChanged(newBackendUpdatesEnabled);
 }
@@ -904,7 +989,8 @@ bool QIfAbstractFeature::acceptServiceObject(QIfServiceObject *serviceObject)
     \l acceptServiceObject method prior to being passed to this method.
 
     The default implementation connects to the signals offered by QIfFeatureInterface and calls
-    QIfFeatureInterface::initialize() afterwards.
+    QIfFeatureInterface::initialize() afterwards. When resuming from disabled backend updates, only
+    the properties which changed meanwhile are applied, if the backend tracks its property state.
 
     When reimplementing please keep in mind to connect all signals before calling this function. e.g.
 
@@ -938,7 +1024,8 @@ void QIfAbstractFeature::connectToServiceObject(QIfServiceObject *serviceObject)
         connect(backend, &QIfFeatureInterface::errorChanged, this, &QIfAbstractFeature::onErrorChanged);
         QObjectPrivate::connect(backend, &QIfFeatureInterface::initializationDone,
                                 d, &QIfAbstractFeaturePrivate::onInitializationDone);
-        backend->initialize();
+        if (!d->resumeBackendUpdates(backend))
+            backend->initialize();
     }
 
     d->m_isConnected = true;
@@ -20,8 +20,11 @@
 #include <private/qobject_p.h>
 #include <private/qtifglobal_p.h>
 
+#include <QtCore/QPointer>
+
 #include "qifabstractfeature.h"
 #include "qiffeatureinterface.h"
+#include "qifpropertywritethrottle_p.h"
 #include "qifserviceobject.h"
 #include "qifservicemanager.h"
 
@@ -35,6 +38,7 @@ public:
     static QIfAbstractFeaturePrivate *get(QIfAbstractFeature *q);
 
     virtual void initialize();
+    virtual bool applyPropertyChanges(const QVariantMap &changes, const QString &zone);
 
     QIfFeatureInterface *backend() const;
     template <class T> T backend() const
@@ -47,10 +51,13 @@ public:
 
     void setDiscoveryResult(QIfAbstractFeature::DiscoveryResult discoveryResult);
     void onInitializationDone();
+    bool resumeBackendUpdates(QIfFeatureInterface *backend);
     void serviceObjectDestroyed();
     void loadServiceObject(QIfServiceManager::SearchFlag searchFlag);
     void onServiceObjectLoaded(QIfServiceObjectHandle handle);
     void onServiceObjectFailure();
+    QIfPropertyWriteThrottle *writeThrottle();
+    void setPropertyWritePolicy(const QString &property, QIfPropertyWriteThrottle::Policy policy, int interval);
 
     QIfAbstractFeature * const q_ptr;
     Q_DECLARE_PUBLIC(QIfAbstractFeature)
@@ -63,7 +70,14 @@ public:
     QString m_configurationId;
     QStringList m_preferredBackends;
     bool m_backendUpdatesEnabled;
+    // The backend and its property state version when the updates were disabled
+    QPointer<QIfFeatureInterface> m_pausedBackend;
+    quint64 m_pausedStateVersion = 0;
     bool m_asynchronousBackendLoading;
+    // Only created if a write policy is set for at least one property
+    QIfPropertyWriteThrottle *m_writeThrottle = nullptr;
+    // Set by features which use the write throttle in their property setters
+    bool m_supportsPropertyWritePolicies = false;
     QList<QIfServiceObjectHandle> m_serviceHandles;
     int m_currentServiceHandleIndex;
     QIfServiceManager::SearchFlag m_currentSearch;
@@ -168,6 +168,7 @@ void QIfAbstractZonedFeature::clearServiceObject()
     Q_D(QIfAbstractZonedFeature);
     qDeleteAll(d->m_zoneFeatures);
     d->m_zoneFeatures.clear();
+    d->m_zoneFeatureHash.clear();
     d->m_zoneFeatureList.clear();
     d->m_zoneFeatureMap.clear();
     emit availableZonesChanged(QStringList());
@@ -266,6 +267,7 @@ void QIfAbstractZonedFeature::initializeZones(const QStringList &zones)
         return;
 
     Q_D(QIfAbstractZonedFeature);
+    bool zonesAdded = false;
     for (const QString &zone : zones) {
         QIfAbstractZonedFeature *f = zoneAt(zone);
         if (!f) {
@@ -276,13 +278,19 @@ void QIfAbstractZonedFeature::initializeZones(const QStringList &zones)
             if (f) {
                 f->d_func()->m_serviceObject = d->m_serviceObject;
                 d->m_zoneFeatures.append(f);
+                d->m_zoneFeatureHash.insert(f->zone(), f);
                 d->m_zoneFeatureList.append(QVariant::fromValue(f));
                 d->m_zoneFeatureMap.insert(f->zone(), QVariant::fromValue(f));
-                emit availableZonesChanged(d->m_zoneFeatureMap.keys());
-                emit zonesChanged();
+                zonesAdded = true;
             }
         }
     }
+
+    // Notify about all new zones at once, instead of once per zone
+    if (zonesAdded) {
+        emit availableZonesChanged(d->m_zoneFeatureMap.keys());
+        emit zonesChanged();
+    }
 }
 
 /*!
@@ -308,10 +316,7 @@ QStringList QIfAbstractZonedFeature::availableZones() const
 QIfAbstractZonedFeature *QIfAbstractZonedFeature::zoneAt(const QString &zone) const
 {
     Q_D(const QIfAbstractZonedFeature);
-    for (QIfAbstractZonedFeature *f : d->m_zoneFeatures)
-        if (f->zone() == zone)
-            return f;
-    return nullptr;
+    return d->m_zoneFeatureHash.value(zone);
 }
 
 /*!
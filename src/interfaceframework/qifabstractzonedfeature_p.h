@@ -30,6 +30,9 @@ public:
 
     QString m_zone;
     QList<QIfAbstractZonedFeature*> m_zoneFeatures;
+    // Used to find the feature of a zone in constant time, as every zoned change signal of the
+    // backend needs to be dispatched to the feature of its zone
+    QHash<QString, QIfAbstractZonedFeature*> m_zoneFeatureHash;
     QVariantMap m_zoneFeatureMap;
     QVariantList m_zoneFeatureList;
 };
@@ -4,6 +4,7 @@
 #include "qifconfiguration.h"
 #include "qifconfiguration_p.h"
 #include "qifabstractfeature.h"
+#include "qifabstractfeature_p.h"
 
 #include "qifqmlconversion_helper.h"
 
@@ -42,6 +43,18 @@ QIfConfigurationManager::~QIfConfigurationManager()
     qDeleteAll(m_settingsHash.constBegin(), m_settingsHash.constEnd());
 }
 
+static void applyPropertyWritePolicies(QIfAbstractFeature *feature, const QVariantMap &propertyWritePolicies)
+{
+    QIfAbstractFeaturePrivate *d = QIfAbstractFeaturePrivate::get(feature);
+    if (!d->m_supportsPropertyWritePolicies) {
+        qCWarning(qLcIfConfig, "Ignoring the propertyWritePolicies for '%s': The feature doesn't support property write policies",
+                  d->m_interface.toUtf8().constData());
+        return;
+    }
+    qCDebug(qLcIfConfig) << "Updating propertyWritePolicies of" << feature << "with" << propertyWritePolicies;
+    d->writeThrottle()->setPolicies(propertyWritePolicies);
+}
+
 QIfAbstractFeature::DiscoveryMode discoveryModeFromString(const QString &modeString)
 {
     QMetaEnum me = QMetaEnum::fromType<QIfAbstractFeature::DiscoveryMode>();
@@ -103,6 +116,10 @@ void QIfConfigurationManager::readInitialSettings(const QString &configPath)
             settingsObject->serviceSettingsSet = true;
             settingsObject->serviceSettings = readGroup(&settings, "serviceSettings");
         }
+        if (settings.childGroups().contains("propertyWritePolicies")) {
+            settingsObject->propertyWritePoliciesSet = true;
+            settingsObject->propertyWritePolicies = readGroup(&settings, "propertyWritePolicies");
+        }
         settings.endGroup();
 
         if (discoveryModeVariant.isValid()) {
@@ -250,6 +267,9 @@ void QIfConfigurationManager::addAbstractFeature(const QString &group, QIfAbstra
         qCDebug(qLcIfConfig) << "Updating asynchronousBackendLoading of" << feature << "with" << so->asynchronousBackendLoading;
         feature->setAsynchronousBackendLoading(so->asynchronousBackendLoading);
     }
+
+    if (so->propertyWritePoliciesSet)
+        applyPropertyWritePolicies(feature, so->propertyWritePolicies);
 }
 
 void QIfConfigurationManager::removeAbstractFeature(const QString &group, QIfAbstractFeature *feature)
@@ -392,6 +412,20 @@ bool QIfConfigurationManager::setAsynchronousBackendLoading(QIfConfiguration *co
     return true;
 }
 
+bool QIfConfigurationManager::setPropertyWritePolicies(QIfSettingsObject *so, const QVariantMap &propertyWritePolicies)
+{
+    Q_ASSERT(so);
+    so->propertyWritePolicies = propertyWritePolicies;
+    so->propertyWritePoliciesSet = true;
+
+    for (auto &feature : std::as_const(so->features)) {
+        if (!feature)
+            continue;
+        applyPropertyWritePolicies(feature, so->propertyWritePolicies);
+    }
+    return true;
+}
+
 bool QIfConfigurationManager::startAutoDiscovery(QIfSettingsObject *so)
 {
     Q_ASSERT(so);
@@ -534,6 +568,14 @@ QIfConfigurationPrivate::QIfConfigurationPrivate(QIfConfiguration *parent)
     serviceSettings/key1/nested2=value2
     \endcode
 
+    The \l propertyWritePolicies setting uses the same syntax:
+
+    \badcode
+    [group1]
+    propertyWritePolicies/temperature/policy=coalesce
+    propertyWritePolicies/temperature/interval=100
+    \endcode
+
     \section1 Environment Overrides
 
     For testing scenarios it is sometimes useful to overwrite certain settings. This can be done
@@ -597,6 +639,11 @@ QIfConfigurationPrivate::QIfConfigurationPrivate(QIfConfiguration *parent)
             \li \l QIfAbstractFeature \l QIfAbstractFeatureListModel
             \li yes
             \li QTIF_ASYNCHRONOUS_BACKEND_LOADING_OVERRIDE
+        \row
+            \li \l propertyWritePolicies
+            \li \l QIfAbstractFeature
+            \li yes
+            \li -
     \endtable
 */
 
@@ -1226,6 +1273,65 @@ bool QIfConfiguration::setServiceObject(QIfServiceObject *serviceObject)
     return false;
 }
 
+/*!
+    \qmlproperty var InterfaceFrameworkConfiguration::propertyWritePolicies
+    \since 6.9
+
+    Holds the propertyWritePolicies setting of the configuration. The value is applied to all
+    features generated by \l ifcodegen with a matching configurationId. Other features can't
+    throttle their property writes and ignore it with a warning.
+    The value is applied when a new matching instance is created and
+    it is also applied to all existing instances.
+
+    Every key is the name of a property and its value is a map with the following keys:
+
+    \value policy
+           \c immediate forwards every write to the backend right away. \c coalesce forwards the
+           first write right away, merges all following writes within the \c interval and only
+           forwards the latest value. \c commitOnIdle only forwards the latest value once no new
+           value was written for the \c interval.
+    \value interval
+           The interval in milliseconds.
+
+    The default policy of a property can also be set by the \c writePolicy and
+    \c writeInterval annotations.
+
+    See \l{Settings Overview} for how to provide initial values and overrides.
+*/
+/*!
+    \property QIfConfiguration::propertyWritePolicies
+    \since 6.9
+
+    Holds the propertyWritePolicies setting of the configuration. The value is applied to all
+    features generated by \l ifcodegen with a matching configurationId. Other features can't
+    throttle their property writes and ignore it with a warning.
+    The value is applied when a new matching instance is created and it is also applied to
+    all existing instances.
+
+    Every key is the name of a property and its value is a QVariantMap with the following keys:
+
+    \value policy
+           \c immediate forwards every write to the backend right away. \c coalesce forwards the
+           first write right away, merges all following writes within the \c interval and only
+           forwards the latest value. \c commitOnIdle only forwards the latest value once no new
+           value was written for the \c interval.
+    \value interval
+           The interval in milliseconds.
+
+    The default policy of a property can also be set by the \c writePolicy and
+    \c writeInterval annotations.
+
+    See \l{Settings Overview} for how to provide initial values and overrides.
+*/
+QVariantMap QIfConfiguration::propertyWritePolicies() const
+{
+    Q_D(const QIfConfiguration);
+
+    Q_CHECK_SETTINGSOBJECT(QVariantMap());
+
+    return d->m_settingsObject->propertyWritePolicies;
+}
+
 /*!
     Sets the \a backendUpdatesEnabled setting of this configuration and applies it to all
     QIfAbstractFeature or QIfAbstractFeatureListModel instances with a matching configurationId.
@@ -1280,6 +1386,32 @@ bool QIfConfiguration::setAsynchronousBackendLoading(bool asynchronousBackendLoa
     return false;
 }
 
+/*!
+    Sets the \a propertyWritePolicies setting of this configuration and applies it to all
+    QIfAbstractFeature instances with a matching configurationId.
+
+    Returns \c false if setting the value failed because an override was active, returns \c true
+    otherwise.
+
+    \since 6.9
+    \sa {Environment Overrides}
+*/
+bool QIfConfiguration::setPropertyWritePolicies(const QVariantMap &propertyWritePolicies)
+{
+    Q_D(QIfConfiguration);
+
+    Q_CHECK_SETTINGSOBJECT(false);
+
+    if (d->m_settingsObject->propertyWritePolicies == propertyWritePolicies)
+        return false;
+
+    if (QIfConfigurationManager::instance()->setPropertyWritePolicies(d->m_settingsObject, propertyWritePolicies)) {
+        emit propertyWritePoliciesChanged(propertyWritePolicies);
+        return true;
+    }
+
+    return false;
+}
 
 /*!
     Starts the auto discovery of all QIfAbstractFeature or QIfAbstractFeatureListModel instances
@@ -1331,6 +1463,8 @@ void QIfConfiguration::componentComplete()
     setServiceObject(tempSettings->serviceObject);
     setBackendUpdatesEnabled(tempSettings->backendUpdatesEnabled);
     setAsynchronousBackendLoading(tempSettings->asynchronousBackendLoading);
+    if (tempSettings->propertyWritePoliciesSet)
+        setPropertyWritePolicies(tempSettings->propertyWritePolicies);
 }
 
 QIfConfiguration::QIfConfiguration(QIfConfigurationPrivate &dd, QObject *parent)
@@ -1693,6 +1827,49 @@ bool QIfConfiguration::isAsynchronousBackendLoadingSet(const QString &group)
     return so ? so->asynchronousBackendLoadingSet : false;
 }
 
+/*!
+    Returns the current value of \c propertyWritePolicies setting of the configuration \a group.
+
+    \since 6.9
+*/
+QVariantMap QIfConfiguration::propertyWritePolicies(const QString &group)
+{
+    QIfSettingsObject *so = QIfConfigurationManager::instance()->settingsObject(group);
+    return so ? so->propertyWritePolicies : QVariantMap();
+}
+
+/*!
+    Sets the \a propertyWritePolicies setting of the configuration \a group and applies it to all
+    QIfAbstractFeature instances with a matching configurationId.
+
+    Returns \c false if setting the value failed because an override was active, returns \c true
+    otherwise.
+
+    \since 6.9
+    \sa {Environment Overrides}
+*/
+bool QIfConfiguration::setPropertyWritePolicies(const QString &group, const QVariantMap &propertyWritePolicies)
+{
+    QIfSettingsObject *so = QIfConfigurationManager::instance()->settingsObject(group, true);
+    return QIfConfigurationManager::instance()->setPropertyWritePolicies(so, propertyWritePolicies);
+}
+
+/*!
+    Returns \c true when the \c propertyWritePolicies setting has been set in the configuration
+    named \a group and \c false otherwise.
+
+    A value is considered as "set" when the corresponding setter was called or a valid value was
+    set in the global ini file.
+
+    \since 6.9
+    \sa {Settings file}
+*/
+bool QIfConfiguration::arePropertyWritePoliciesSet(const QString &group)
+{
+    QIfSettingsObject *so = QIfConfigurationManager::instance()->settingsObject(group);
+    return so ? so->propertyWritePoliciesSet : false;
+}
+
 /*!
     Starts the auto discovery of all QIfAbstractFeature or QIfAbstractFeatureListModel instances
     in the configuration \a group.
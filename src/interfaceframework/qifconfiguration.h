@@ -34,6 +34,7 @@ class Q_QTINTERFACEFRAMEWORK_EXPORT QIfConfiguration : public QObject, public QQ
     Q_PROPERTY(QIfServiceObject *serviceObject READ serviceObject WRITE setServiceObject NOTIFY serviceObjectChanged FINAL)
     Q_PROPERTY(bool backendUpdatesEnabled READ backendUpdatesEnabled WRITE setBackendUpdatesEnabled NOTIFY backendUpdatesEnabledChanged REVISION(6, 8) FINAL)
     Q_PROPERTY(bool asynchronousBackendLoading READ asynchronousBackendLoading WRITE setAsynchronousBackendLoading NOTIFY asynchronousBackendLoadingChanged REVISION(6, 8) FINAL)
+    Q_PROPERTY(QVariantMap propertyWritePolicies READ propertyWritePolicies WRITE setPropertyWritePolicies NOTIFY propertyWritePoliciesChanged REVISION(6, 9) FINAL)
 
 public:
     explicit QIfConfiguration(const QString &name = QString(), QObject *parent = nullptr);
@@ -50,6 +51,7 @@ public:
     QIfServiceObject *serviceObject() const;
     bool backendUpdatesEnabled() const;
     bool asynchronousBackendLoading() const;
+    QVariantMap propertyWritePolicies() const;
 
 public Q_SLOTS:
     void setIgnoreOverrideWarnings(bool ignoreOverrideWarnings);
@@ -62,6 +64,7 @@ public Q_SLOTS:
     bool setServiceObject(QIfServiceObject *serviceObject);
     Q_REVISION(6, 8) bool setBackendUpdatesEnabled(bool backendUpdatesEnabled);
     Q_REVISION(6, 8) bool setAsynchronousBackendLoading(bool asynchronousBackendLoading);
+    Q_REVISION(6, 9) bool setPropertyWritePolicies(const QVariantMap &propertyWritePolicies);
     Q_REVISION(6, 8) bool startAutoDiscovery();
 
 Q_SIGNALS:
@@ -76,6 +79,7 @@ Q_SIGNALS:
     void ignoreOverrideWarningsChanged(bool ignoreOverrideWarnings);
     Q_REVISION(6, 8) void backendUpdatesEnabledChanged(bool backendUpdatesEnabled);
     Q_REVISION(6, 8) void asynchronousBackendLoadingChanged(bool asynchronousBackendLoading);
+    Q_REVISION(6, 9) void propertyWritePoliciesChanged(const QVariantMap &propertyWritePolicies);
 
 public: //static methods
     static bool exists(const QString &group);
@@ -112,6 +116,10 @@ public: //static methods
     static bool setAsynchronousBackendLoading(const QString &group, bool asynchronousBackendLoading);
     static bool isAsynchronousBackendLoadingSet(const QString &group);
 
+    static QVariantMap propertyWritePolicies(const QString &group);
+    static bool setPropertyWritePolicies(const QString &group, const QVariantMap &propertyWritePolicies);
+    static bool arePropertyWritePoliciesSet(const QString &group);
+
     static bool startAutoDiscovery(const QString &group);
 
 protected:
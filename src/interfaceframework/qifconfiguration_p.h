@@ -51,6 +51,8 @@ public:
     bool asynchronousBackendLoading = false;
     bool asynchronousBackendLoadingSet = false;
     bool asynchronousBackendLoadingEnvOverride = false;
+    QVariantMap propertyWritePolicies;
+    bool propertyWritePoliciesSet = false;
     QList<QPointer<QIfProxyServiceObject>> serviceObjects;
     QList<QPointer<QIfAbstractFeature>> features;
 };
@@ -76,6 +78,7 @@ public:
     bool setServiceObject(QIfSettingsObject *so, QIfServiceObject *serviceObject);
     bool setBackendUpdatesEnabled(QIfSettingsObject *so, bool backendUpdatesEnabled);
     bool setAsynchronousBackendLoading(QIfConfiguration *config, QIfSettingsObject *so, bool asynchronousBackendLoading);
+    bool setPropertyWritePolicies(QIfSettingsObject *so, const QVariantMap &propertyWritePolicies);
     bool startAutoDiscovery(QIfSettingsObject *so);
 
     QVariantMap readGroup(QSettings *settings, QAnyStringView group);
@@ -4,9 +4,22 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qiffeatureinterface.h"
+#include "qiffeatureinterface_p.h"
 
 QT_BEGIN_NAMESPACE
 
+void QIfFeatureInterfacePrivate::recordPropertyChanges(const QVariantMap &changes, const QString &zone)
+{
+    if (!m_propertyStateTracking)
+        return;
+
+    // All values of a change set share one version, as they are delivered together
+    m_propertyStateVersion++;
+    QHash<QString, PropertyState> &state = m_propertyState[zone];
+    for (auto it = changes.cbegin(); it != changes.cend(); ++it)
+        state.insert(it.key(), { it.value(), m_propertyStateVersion });
+}
+
 /*!
     \class QIfFeatureInterface
     \inmodule QtInterfaceFramework
@@ -71,12 +84,251 @@ QT_BEGIN_NAMESPACE
     that is done, the change signal is emitted to inform the feature about the new state of the
     property.
 
+    \section1 Batched property updates
+
+    When many properties change at the same time, e.g. when a new vehicle state is received,
+    emitting one change signal per property results in one update per property in the feature and,
+    for remote backends, in one message per property. Instead, the backend can report all changes
+    as a single change set:
+
+    \code
+    void CoffeMachineImplementation::onStateReceived(const State &state)
+    {
+        beginPropertyUpdate();
+        updateProperty(u"currentTemperature"_s, state.currentTemperature);
+        updateProperty(u"targetTemperature"_s, state.targetTemperature);
+        commitPropertyUpdate();
+    }
+    \endcode
+
+    The feature applies all values of a change set before any change signal is emitted, which
+    means every change signal already sees the complete new state.
+
+    \section1 Resuming paused features
+
+    A feature which disables its backend updates using QIfAbstractFeature::backendUpdatesEnabled
+    normally calls initialize() again once the updates are enabled again, which makes the backend
+    report all properties to all connected features.
+
+    A backend which reports all its properties using updateProperty(), or records them using
+    recordProperty() when emitting the change signals of the properties, including the initial
+    values in initialize(), can enable the property state tracking instead. The backend then
+    remembers the last value and the version of every reported property, and a resuming feature
+    only applies the properties which changed while its updates were disabled. Neither
+    initialize() is called, nor are the other features informed about the resume.
+
+    \code
+    CoffeMachineImplementation::CoffeMachineImplementation(QObject *parent)
+        : CoffeMachineInterface(parent)
+    {
+        setPropertyStateTrackingEnabled(true);
+    }
+    \endcode
+
     \sa QIfAbstractFeature
 */
 
 QIfFeatureInterface::QIfFeatureInterface(QObject *parent)
-    : QObject(parent)
+    : QObject(*new QIfFeatureInterfacePrivate, parent)
+{
+}
+
+/*!
+    \internal
+*/
+QIfFeatureInterface::QIfFeatureInterface(QIfFeatureInterfacePrivate &dd, QObject *parent)
+    : QObject(dd, parent)
+{
+}
+
+/*!
+    \since 6.9
+
+    Starts a batched property update.
+
+    All changes reported with updateProperty() are collected until commitPropertyUpdate() is
+    called. Calls can be nested, the change sets are only emitted once the outermost update is
+    committed.
+
+    \sa commitPropertyUpdate() propertiesChanged()
+*/
+void QIfFeatureInterface::beginPropertyUpdate()
+{
+    Q_D(QIfFeatureInterface);
+    d->m_propertyUpdateDepth++;
+}
+
+/*!
+    \since 6.9
+
+    Reports the new \a value of the property \a name in \a zone.
+
+    If no batched update is active, the propertiesChanged() signal is emitted right away with a
+    change set containing only this property. Otherwise the value is added to the change set of
+    the current update, replacing any earlier value of the same property.
+
+    \sa beginPropertyUpdate()
+*/
+void QIfFeatureInterface::updateProperty(const QString &name, const QVariant &value, const QString &zone)
+{
+    Q_D(QIfFeatureInterface);
+    if (!d->m_propertyUpdateDepth) {
+        const QVariantMap changes({{ name, value }});
+        d->recordPropertyChanges(changes, zone);
+        Q_EMIT propertiesChanged(changes, zone);
+        return;
+    }
+
+    auto it = d->m_pendingChanges.find(zone);
+    if (it == d->m_pendingChanges.end()) {
+        d->m_pendingZones.append(zone);
+        it = d->m_pendingChanges.insert(zone, QVariantMap());
+    }
+    it->insert(name, value);
+}
+
+/*!
+    \since 6.9
+
+    Finishes a batched property update started with beginPropertyUpdate().
+
+    Once the outermost update is committed, the propertiesChanged() signal is emitted once for
+    every zone which has changed properties.
+*/
+void QIfFeatureInterface::commitPropertyUpdate()
+{
+    Q_D(QIfFeatureInterface);
+    if (!d->m_propertyUpdateDepth) {
+        qWarning("QIfFeatureInterface::commitPropertyUpdate() called without beginPropertyUpdate()");
+        return;
+    }
+    if (--d->m_propertyUpdateDepth)
+        return;
+
+    const QStringList zones = std::exchange(d->m_pendingZones, {});
+    const QHash<QString, QVariantMap> changes = std::exchange(d->m_pendingChanges, {});
+    for (const QString &zone : zones) {
+        const QVariantMap zoneChanges = changes.value(zone);
+        d->recordPropertyChanges(zoneChanges, zone);
+        Q_EMIT propertiesChanged(zoneChanges, zone);
+    }
+}
+
+/*!
+    \since 6.9
+
+    Returns \c true if a batched property update is in progress.
+*/
+bool QIfFeatureInterface::isPropertyUpdateActive() const
+{
+    Q_D(const QIfFeatureInterface);
+    return d->m_propertyUpdateDepth > 0;
+}
+
+/*!
+    \since 6.9
+
+    Records the new \a value of the property \a name in \a zone in the property state, without
+    emitting the propertiesChanged() signal.
+
+    Use this function instead of updateProperty() if the change was already reported to the
+    features using the change signal of the property. This way the property state stays complete,
+    but every feature handles the change only once.
+
+    The value is recorded right away, even if a batched property update is active.
+
+    \sa setPropertyStateTrackingEnabled() updateProperty()
+*/
+void QIfFeatureInterface::recordProperty(const QString &name, const QVariant &value, const QString &zone)
 {
+    Q_D(QIfFeatureInterface);
+    d->recordPropertyChanges(QVariantMap({{ name, value }}), zone);
+}
+
+/*!
+    \since 6.9
+
+    Enables the property state tracking if \a enabled is \c true.
+
+    While enabled, the last value of every property reported with updateProperty() is stored
+    together with a version. A feature which resumes its backend updates uses
+    propertyChangesSince() to only apply the changes it missed, instead of calling initialize().
+
+    Only enable the tracking if all property changes are reported with updateProperty() or
+    recordProperty(), as changes reported by other signals can't be replayed. Disabling the tracking discards the
+    stored state.
+
+    \sa QIfAbstractFeature::backendUpdatesEnabled
+*/
+void QIfFeatureInterface::setPropertyStateTrackingEnabled(bool enabled)
+{
+    Q_D(QIfFeatureInterface);
+    if (d->m_propertyStateTracking == enabled)
+        return;
+
+    d->m_propertyStateTracking = enabled;
+    d->m_propertyState.clear();
+    // Nothing is known about the changes before, features paused earlier need to reinitialize
+    if (enabled)
+        d->m_propertyStateStartVersion = ++d->m_propertyStateVersion;
+}
+
+/*!
+    \since 6.9
+
+    Returns \c true if the property state tracking is enabled.
+
+    \sa setPropertyStateTrackingEnabled()
+*/
+bool QIfFeatureInterface::isPropertyStateTrackingEnabled() const
+{
+    Q_D(const QIfFeatureInterface);
+    return d->m_propertyStateTracking;
+}
+
+/*!
+    \since 6.9
+
+    Returns the version of the current property state, which is increased with every change set.
+    Returns \c 0 if the property state tracking is disabled.
+
+    \sa propertyChangesSince()
+*/
+quint64 QIfFeatureInterface::propertyStateVersion() const
+{
+    Q_D(const QIfFeatureInterface);
+    return d->m_propertyStateTracking ? d->m_propertyStateVersion : 0;
+}
+
+/*!
+    \since 6.9
+
+    Stores all properties which changed after the state had the given \a version in \a changes,
+    as change sets per zone.
+
+    Returns \c false if the changes since \a version are not known, because the property state
+    tracking is disabled or was enabled after that version.
+
+    \sa propertyStateVersion()
+*/
+bool QIfFeatureInterface::propertyChangesSince(quint64 version, QHash<QString, QVariantMap> *changes) const
+{
+    Q_D(const QIfFeatureInterface);
+    Q_ASSERT(changes);
+    if (!d->m_propertyStateTracking || version < d->m_propertyStateStartVersion)
+        return false;
+
+    changes->clear();
+    for (auto zoneIt = d->m_propertyState.cbegin(); zoneIt != d->m_propertyState.cend(); ++zoneIt) {
+        QVariantMap zoneChanges;
+        for (auto it = zoneIt->cbegin(); it != zoneIt->cend(); ++it) {
+            if (it->version > version)
+                zoneChanges.insert(it.key(), it->value);
+        }
+        if (!zoneChanges.isEmpty())
+            changes->insert(zoneIt.key(), zoneChanges);
+    }
+    return true;
 }
 
 /*!
@@ -107,6 +359,18 @@ QIfFeatureInterface::QIfFeatureInterface(QObject *parent)
     \sa initialize
 */
 
+/*!
+    \fn void QIfFeatureInterface::propertiesChanged(const QVariantMap &changes, const QString &zone)
+    \since 6.9
+
+    The signal is emitted when the properties in \a changes changed their value in \a zone.
+    The keys of \a changes are the property names and the values are the new property values.
+
+    For features which are not zoned, \a zone is an empty string.
+
+    \sa beginPropertyUpdate() updateProperty()
+*/
+
 QT_END_NAMESPACE
 
 #include "moc_qiffeatureinterface.cpp"
@@ -6,11 +6,15 @@
 #ifndef QIFFEATUREINTERFACE_H
 #define QIFFEATUREINTERFACE_H
 
+#include <QtCore/QHash>
+#include <QtCore/QVariantMap>
 #include <QtInterfaceFramework/QIfAbstractFeature>
 #include <QtInterfaceFramework/qtifglobal.h>
 
 QT_BEGIN_NAMESPACE
 
+class QIfFeatureInterfacePrivate;
+
 class Q_QTINTERFACEFRAMEWORK_EXPORT QIfFeatureInterface : public QObject
 {
     Q_OBJECT
@@ -20,9 +24,27 @@ public:
 
     virtual void initialize() = 0;
 
+    void beginPropertyUpdate();
+    void updateProperty(const QString &name, const QVariant &value, const QString &zone = QString());
+    void commitPropertyUpdate();
+    bool isPropertyUpdateActive() const;
+    void recordProperty(const QString &name, const QVariant &value, const QString &zone = QString());
+
+    void setPropertyStateTrackingEnabled(bool enabled);
+    bool isPropertyStateTrackingEnabled() const;
+    quint64 propertyStateVersion() const;
+    bool propertyChangesSince(quint64 version, QHash<QString, QVariantMap> *changes) const;
+
 Q_SIGNALS:
     void errorChanged(QIfAbstractFeature::Error error, const QString &message = QString());
     void initializationDone();
+    void propertiesChanged(const QVariantMap &changes, const QString &zone);
+
+protected:
+    QIfFeatureInterface(QIfFeatureInterfacePrivate &dd, QObject *parent = nullptr);
+
+private:
+    Q_DECLARE_PRIVATE(QIfFeatureInterface)
 };
 
 QT_END_NAMESPACE
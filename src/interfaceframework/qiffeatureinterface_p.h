@@ -0,0 +1,53 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIFFEATUREINTERFACE_P_H
+#define QIFFEATUREINTERFACE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qobject_p.h>
+#include <private/qtifglobal_p.h>
+
+#include <QtCore/QHash>
+#include <QtCore/QVariantMap>
+
+#include "qiffeatureinterface.h"
+
+QT_BEGIN_NAMESPACE
+
+class Q_QTINTERFACEFRAMEWORK_EXPORT QIfFeatureInterfacePrivate : public QObjectPrivate
+{
+public:
+    int m_propertyUpdateDepth = 0;
+    // The zones in the order they were first touched, to emit the change sets in a stable order
+    QStringList m_pendingZones;
+    QHash<QString, QVariantMap> m_pendingChanges;
+
+    struct PropertyState {
+        QVariant value;
+        quint64 version = 0;
+    };
+
+    void recordPropertyChanges(const QVariantMap &changes, const QString &zone);
+
+    bool m_propertyStateTracking = false;
+    quint64 m_propertyStateVersion = 0;
+    // The version at which the tracking was enabled, older versions can't be resumed from
+    quint64 m_propertyStateStartVersion = 0;
+    // The last value of every property, per zone
+    QHash<QString, QHash<QString, PropertyState>> m_propertyState;
+};
+
+QT_END_NAMESPACE
+
+#endif // QIFFEATUREINTERFACE_P_H
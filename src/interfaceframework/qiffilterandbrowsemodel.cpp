@@ -12,26 +12,39 @@
 
 #include <QDebug>
 #include <QMetaObject>
+#include <QTimer>
+
+#include <algorithm>
 
 using namespace Qt::StringLiterals;
 
 QT_BEGIN_NAMESPACE
 
+namespace {
+    constexpr qsizetype parsedQueryCacheSize = 16;
+}
+
 QIfFilterAndBrowseModelPrivate::QIfFilterAndBrowseModelPrivate(const QString &interface, QIfFilterAndBrowseModel *model)
     : QIfPagingModelPrivate(interface, model)
     , q_ptr(model)
-    , m_queryTerm(nullptr)
+    , m_queryDelay(0)
+    , m_queryTimer(nullptr)
     , m_canGoBack(false)
+    , m_historySize(0)
+    , m_revalidating(false)
 {
 }
 
 QIfFilterAndBrowseModelPrivate::~QIfFilterAndBrowseModelPrivate()
 {
-    delete m_queryTerm;
 }
 
 void QIfFilterAndBrowseModelPrivate::resetModel()
 {
+    //A delayed query is applied right away
+    if (m_queryTimer)
+        m_queryTimer->stop();
+
     QIfFilterAndBrowseModelInterface* backend = searchBackend();
 
     if (backend)
@@ -54,44 +67,87 @@ void QIfFilterAndBrowseModelPrivate::parseQuery()
         return;
     }
 
-    QIfQueryParser parser;
-    parser.setQuery(m_query);
-    parser.setAllowedIdentifiers(m_queryIdentifiers);
-
-    QIfAbstractQueryTerm* queryTerm = parser.parse();
+    const ParsedQuery parsed = parsedQuery(m_query);
 
-    if (!queryTerm) {
-        qtif_qmlOrCppWarning(q_ptr, parser.lastError());
+    if (!parsed.queryTerm) {
+        qtif_qmlOrCppWarning(q_ptr, parsed.error);
         return;
     }
-    QList<QIfOrderTerm> orderTerms = parser.orderTerms();
 
-    setupFilter(queryTerm, orderTerms);
+    setupFilter(parsed.queryTerm, parsed.orderTerms);
 }
 
-void QIfFilterAndBrowseModelPrivate::setupFilter(QIfAbstractQueryTerm* queryTerm, const QList<QIfOrderTerm> &orderTerms)
+/*
+    Returns the parsed \a query for the current query identifiers.
+
+    The query is only parsed if it is not part of the cache yet. The cached term trees are shared
+    with the backend and are never modified.
+*/
+const QIfFilterAndBrowseModelPrivate::ParsedQuery &QIfFilterAndBrowseModelPrivate::parsedQuery(const QString &query)
+{
+    auto it = std::find_if(m_parsedQueries.begin(), m_parsedQueries.end(), [this, &query](const ParsedQuery &parsed) {
+        return parsed.query == query && parsed.identifiers == m_queryIdentifiers;
+    });
+
+    if (it != m_parsedQueries.end()) {
+        //Move it to the end to mark it as the most recently used query
+        if (it != std::prev(m_parsedQueries.end())) {
+            ParsedQuery parsed = std::move(*it);
+            m_parsedQueries.erase(it);
+            m_parsedQueries.append(std::move(parsed));
+        }
+        return m_parsedQueries.constLast();
+    }
+
+    QIfQueryParser parser;
+    parser.setQuery(query);
+    parser.setAllowedIdentifiers(m_queryIdentifiers);
+
+    ParsedQuery parsed;
+    parsed.query = query;
+    parsed.identifiers = m_queryIdentifiers;
+    parsed.queryTerm.reset(parser.parse());
+    if (parsed.queryTerm)
+        parsed.orderTerms = parser.orderTerms();
+    else
+        parsed.error = parser.lastError();
+
+    if (m_parsedQueries.count() >= parsedQueryCacheSize)
+        m_parsedQueries.removeFirst();
+    m_parsedQueries.append(std::move(parsed));
+    return m_parsedQueries.constLast();
+}
+
+void QIfFilterAndBrowseModelPrivate::setupFilter(const QSharedPointer<QIfAbstractQueryTerm> &queryTerm, const QList<QIfOrderTerm> &orderTerms)
 {
     //1. Tell the backend about the new filter (or none)
     QIfFilterAndBrowseModelInterface* backend = searchBackend();
     if (backend)
-        backend->setupFilter(m_identifier, queryTerm, orderTerms);
-
-    //2. Now it's safe to delete the old filter
-    delete m_queryTerm;
-    m_queryTerm = nullptr;
+        backend->setupFilter(m_identifier, queryTerm.data(), orderTerms);
 
-    //3. Save the new filter
+    //2. Now it's safe to release the old filter. It is deleted once it's not cached anymore
     m_queryTerm = queryTerm;
     m_orderTerms = orderTerms;
 }
 
+void QIfFilterAndBrowseModelPrivate::onQueryTimeout()
+{
+    //The query is checked in resetModel
+    m_revalidating = false;
+    resetModel();
+}
+
 void QIfFilterAndBrowseModelPrivate::clearToDefaults()
 {
     QIfPagingModelPrivate::clearToDefaults();
 
     Q_Q(QIfFilterAndBrowseModel);
-    delete m_queryTerm;
-    m_queryTerm = nullptr;
+    m_queryTerm.reset();
+    m_parsedQueries.clear();
+    if (m_queryTimer)
+        m_queryTimer->stop();
+    m_queryDelay = 0;
+    emit q->queryDelayChanged(m_queryDelay);
     m_query.clear();
     emit q->queryChanged(m_query);
     m_contentType = QString();
@@ -102,6 +158,10 @@ void QIfFilterAndBrowseModelPrivate::clearToDefaults()
     m_availableContentTypes.clear();
     emit q->availableContentTypesChanged(m_availableContentTypes);
     m_canGoForward.clear();
+    m_history.clear();
+    m_historySize = 0;
+    emit q->historySizeChanged(m_historySize);
+    m_revalidating = false;
 
     //Explicitly call the PagingModel resetModel to also reset the fetched data
     QIfPagingModelPrivate::resetModel();
@@ -139,6 +199,9 @@ void QIfFilterAndBrowseModelPrivate::onContentTypeChanged(QUuid identifier, cons
         return;
 
     Q_Q(QIfFilterAndBrowseModel);
+    // The content restored from the history is only kept if the backend really went back to it
+    const bool revalidate = std::exchange(m_revalidating, false) && m_contentType == contentType;
+
     // Don't return if the content type is already correct. We still need to continue to update the
     // query and start fetching again
     if (m_contentType != contentType) {
@@ -147,7 +210,10 @@ void QIfFilterAndBrowseModelPrivate::onContentTypeChanged(QUuid identifier, cons
     }
     parseQuery();
 
-    QIfPagingModelPrivate::resetModel();
+    if (revalidate)
+        revalidateModel();
+    else
+        QIfPagingModelPrivate::resetModel();
 }
 
 void QIfFilterAndBrowseModelPrivate::onAvailableContentTypesChanged(const QStringList &contentTypes)
@@ -182,10 +248,120 @@ void QIfFilterAndBrowseModelPrivate::updateContentType(const QString &contentTyp
     m_contentTypeRequested = contentType;
     m_canGoForward.clear();
     m_canGoBack = false;
+    m_revalidating = false;
 
     resetModel();
 }
 
+void QIfFilterAndBrowseModelPrivate::pushHistory(int anchorIndex)
+{
+    if (m_historySize <= 0)
+        return;
+
+    HistoryEntry entry;
+    entry.contentType = m_contentType;
+    entry.query = m_query;
+    entry.queryIdentifiers = m_queryIdentifiers;
+    entry.itemList = m_itemList;
+    entry.availableChunks = m_availableChunks;
+    entry.recentlyUsedChunks = m_recentlyUsedChunks;
+    entry.canGoForward = m_canGoForward;
+    entry.loadingType = m_loadingType;
+    entry.chunkSize = m_chunkSize;
+    entry.fetchedDataCount = m_fetchedDataCount;
+    entry.anchorIndex = anchorIndex;
+    entry.moreAvailable = m_moreAvailable;
+    entry.canGoBack = m_canGoBack;
+    m_history.append(std::move(entry));
+
+    trimHistory();
+}
+
+bool QIfFilterAndBrowseModelPrivate::restoreHistory()
+{
+    if (m_history.isEmpty())
+        return false;
+
+    HistoryEntry entry = m_history.takeLast();
+    // The cached rows can't be used anymore once the chunks are organized differently
+    if (entry.loadingType != m_loadingType || entry.chunkSize != m_chunkSize) {
+        m_history.clear();
+        return false;
+    }
+
+    Q_Q(QIfFilterAndBrowseModel);
+    q->beginResetModel();
+    m_itemList = std::move(entry.itemList);
+    m_availableChunks = std::move(entry.availableChunks);
+    m_recentlyUsedChunks = std::move(entry.recentlyUsedChunks);
+    m_canGoForward = std::move(entry.canGoForward);
+    m_pendingChunks.clear();
+    //Replies to requests for the content which is left are outdated
+    m_generation++;
+    m_lastAccessedChunk = -1;
+    m_accessedChunks.clear();
+    m_visibleChunks = 1;
+    m_fetchedDataCount = entry.fetchedDataCount;
+    //No more data can be fetched until the backend went back to this content as well
+    m_moreAvailable = false;
+    q->endResetModel();
+
+    m_contentTypeRequested = entry.contentType;
+    if (m_contentType != entry.contentType) {
+        m_contentType = entry.contentType;
+        emit q->contentTypeChanged(m_contentType);
+    }
+    if (m_query != entry.query) {
+        m_query = entry.query;
+        emit q->queryChanged(m_query);
+    }
+    m_queryIdentifiers = entry.queryIdentifiers;
+    if (m_canGoBack != entry.canGoBack) {
+        m_canGoBack = entry.canGoBack;
+        emit q->canGoBackChanged(m_canGoBack);
+    }
+
+    emit q->historyRestored(entry.anchorIndex);
+    return true;
+}
+
+void QIfFilterAndBrowseModelPrivate::revalidateModel()
+{
+    // Fetch all rows restored from the history again. They are updated in place once the data
+    // arrives, which keeps the position of the views.
+    m_pendingChunks.clear();
+
+    if (m_loadingType == QIfPagingModel::FetchMore) {
+        const int count = m_fetchedDataCount;
+        if (count == 0) {
+            QIfPagingModelPrivate::resetModel();
+            return;
+        }
+        for (int start = 0; start < count; start += m_chunkSize)
+            fetchData(start);
+        return;
+    }
+
+    bool fetched = false;
+    for (qsizetype i = 0; i < m_availableChunks.size(); i++) {
+        if (!m_availableChunks.testBit(i))
+            continue;
+        m_availableChunks.clearBit(i);
+        fetchData(int(i) * m_chunkSize);
+        fetched = true;
+    }
+
+    if (!fetched)
+        QIfPagingModelPrivate::resetModel();
+}
+
+void QIfFilterAndBrowseModelPrivate::trimHistory()
+{
+    const qsizetype maximum = qMax(0, m_historySize);
+    if (m_history.count() > maximum)
+        m_history.remove(0, m_history.count() - maximum);
+}
+
 /*!
     \class QIfFilterAndBrowseModel
     \inmodule QtInterfaceFramework
@@ -264,6 +440,10 @@ void QIfFilterAndBrowseModelPrivate::updateContentType(const QString &contentTyp
         \li goBack()
     \endlist
 
+    By default, the content of the previous level is fetched again when going back. By setting the
+    historySize property, the fetched rows of the previous levels are kept and shown right away
+    instead.
+
     \section2 Navigation Types
 
     The QIfFilterAndBrowseModel supports two navigation types when browsing through the available data: for most use cases
@@ -412,6 +592,10 @@ void QIfFilterAndBrowseModelPrivate::updateContentType(const QString &contentTyp
         \li goBack()
     \endlist
 
+    By default, the content of the previous level is fetched again when going back. By setting the
+    historySize property, the fetched rows of the previous levels are kept and shown right away
+    instead.
+
     \section2 Navigation Types
 
     The FilterAndBrowseModel supports two navigation types when browsing through the available data: for most use cases
@@ -495,10 +679,72 @@ void QIfFilterAndBrowseModel::setQuery(const QString &query)
     d->m_query = query;
     emit queryChanged(d->m_query);
 
+    if (d->m_queryDelay > 0) {
+        //Only the last query is used once it didn't change for the configured time
+        if (!d->m_queryTimer) {
+            d->m_queryTimer = new QTimer(this);
+            d->m_queryTimer->setSingleShot(true);
+            QObjectPrivate::connect(d->m_queryTimer, &QTimer::timeout,
+                                    d, &QIfFilterAndBrowseModelPrivate::onQueryTimeout);
+        }
+        d->m_queryTimer->start(d->m_queryDelay);
+        return;
+    }
+
     //The query is checked in resetModel
+    d->m_revalidating = false;
     d->resetModel();
 }
 
+/*!
+    \qmlproperty int FilterAndBrowseModel::queryDelay
+    \brief Holds the time in milliseconds the query needs to stay unchanged before it is used.
+    \since 6.9
+
+    By default, this property is \c 0, which means that the content is reset right away whenever
+    the query changes.
+
+    If set to a positive value, changing the query restarts a timer and the content is only reset
+    once the query didn't change for queryDelay milliseconds. This avoids filtering the content for
+    every intermediate query, e.g. when the query is updated while the user is typing.
+*/
+
+/*!
+    \property QIfFilterAndBrowseModel::queryDelay
+    \brief Holds the time in milliseconds the query needs to stay unchanged before it is used.
+    \since 6.9
+
+    By default, this property is \c 0, which means that the content is reset right away whenever
+    the query changes.
+
+    If set to a positive value, changing the query restarts a timer and the content is only reset
+    once the query didn't change for queryDelay milliseconds. This avoids filtering the content for
+    every intermediate query, e.g. when the query is updated while the user is typing.
+*/
+int QIfFilterAndBrowseModel::queryDelay() const
+{
+    Q_D(const QIfFilterAndBrowseModel);
+    return d->m_queryDelay;
+}
+
+void QIfFilterAndBrowseModel::setQueryDelay(int queryDelay)
+{
+    Q_D(QIfFilterAndBrowseModel);
+    if (d->m_queryDelay == queryDelay)
+        return;
+
+    d->m_queryDelay = queryDelay;
+    emit queryDelayChanged(queryDelay);
+
+    //A query which is still waiting needs to be used with the new delay
+    if (d->m_queryTimer && d->m_queryTimer->isActive()) {
+        if (queryDelay > 0)
+            d->m_queryTimer->start(queryDelay);
+        else
+            d->onQueryTimeout();
+    }
+}
+
 /*!
     \qmlproperty string FilterAndBrowseModel::contentType
     \brief Holds the current type of content displayed in this model.
@@ -528,6 +774,8 @@ void QIfFilterAndBrowseModel::setContentType(const QString &contentType)
     if (d->m_contentTypeRequested == contentType)
         return;
 
+    //The history only contains the levels which lead to the current content
+    d->m_history.clear();
     d->updateContentType(contentType);
 }
 
@@ -569,6 +817,77 @@ bool QIfFilterAndBrowseModel::canGoBack() const
     return d->m_canGoBack;
 }
 
+/*!
+    \qmlproperty int FilterAndBrowseModel::historySize
+    \brief Holds the maximum number of navigation levels which are kept in memory.
+    \since 6.9
+
+    By default, this property is \c 0, which means that the content is fetched again from the
+    backend when calling goBack().
+
+    If set to a positive value, the fetched rows of up to historySize levels are kept when
+    navigating forward using the InModelNavigation type. Going back shows the kept rows right
+    away and the historyRestored() signal is emitted. The rows are fetched again in the background
+    and are updated in place, once the backend went back to the previous content as well.
+
+    See \l Browsing for more information.
+*/
+
+/*!
+    \property QIfFilterAndBrowseModel::historySize
+    \brief Holds the maximum number of navigation levels which are kept in memory.
+    \since 6.9
+
+    By default, this property is \c 0, which means that the content is fetched again from the
+    backend when calling goBack().
+
+    If set to a positive value, the fetched rows of up to historySize levels are kept when
+    navigating forward using the InModelNavigation type. Going back shows the kept rows right
+    away and the historyRestored() signal is emitted. The rows are fetched again in the background
+    and are updated in place, once the backend went back to the previous content as well.
+
+    See \l Browsing for more information.
+*/
+int QIfFilterAndBrowseModel::historySize() const
+{
+    Q_D(const QIfFilterAndBrowseModel);
+    return d->m_historySize;
+}
+
+void QIfFilterAndBrowseModel::setHistorySize(int historySize)
+{
+    Q_D(QIfFilterAndBrowseModel);
+    if (d->m_historySize == historySize)
+        return;
+
+    d->m_historySize = historySize;
+    emit historySizeChanged(historySize);
+
+    d->trimHistory();
+}
+
+/*!
+    \qmlsignal FilterAndBrowseModel::historyRestored(int anchorIndex)
+    \since 6.9
+
+    This signal is emitted when goBack() restored the previous content from the navigation
+    history. The \a anchorIndex is the index of the item which was used to go forward and can be
+    used to restore the position of the view, e.g. by calling ListView::positionViewAtIndex().
+
+    \sa historySize
+*/
+
+/*!
+    \fn void QIfFilterAndBrowseModel::historyRestored(int anchorIndex)
+    \since 6.9
+
+    This signal is emitted when goBack() restored the previous content from the navigation
+    history. The \a anchorIndex is the index of the item which was used to go forward and can be
+    used to restore the position of the view.
+
+    \sa historySize
+*/
+
 /*!
     \reimp
 */
@@ -616,13 +935,29 @@ void QIfFilterAndBrowseModel::goBack()
         return;
     }
 
+    const QString previousContentType = d->m_contentTypeRequested;
+    const QString restoredContentType = d->restoreHistory() ? d->m_contentTypeRequested : QString();
+
     QIfPendingReply<QString> reply = backend->goBack(d->m_identifier);
-    reply.then([this, reply](const QString &value) {
+    reply.then([this, reply, restoredContentType](const QString &value) {
         Q_D(QIfFilterAndBrowseModel);
-        d->updateContentType(value);
+        if (!restoredContentType.isEmpty() && value == restoredContentType) {
+            //Only check whether the restored content is still up to date
+            d->m_revalidating = true;
+            d->resetModel();
+        } else {
+            d->m_history.clear();
+            d->updateContentType(value);
+        }
     },
-    [this]() {
+    [this, restoredContentType, previousContentType]() {
         qtif_qmlOrCppWarning(this, "Going backward failed");
+        if (!restoredContentType.isEmpty()) {
+            //The backend still provides the content which was shown before
+            Q_D(QIfFilterAndBrowseModel);
+            d->m_history.clear();
+            d->updateContentType(previousContentType);
+        }
     });
 }
 
@@ -718,8 +1053,9 @@ QIfFilterAndBrowseModel *QIfFilterAndBrowseModel::goForward(int i, NavigationTyp
         }
     } else {
         QIfPendingReply<QString> reply = backend->goForward(d->m_identifier, i);
-        reply.then([this, reply](const QString &value) {
+        reply.then([this, reply, i](const QString &value) {
             Q_D(QIfFilterAndBrowseModel);
+            d->pushHistory(i);
             d->updateContentType(value);
         },
         [this]() {
@@ -22,9 +22,11 @@ class Q_QTINTERFACEFRAMEWORK_EXPORT QIfFilterAndBrowseModel : public QIfPagingMo
     QML_NAMED_ELEMENT(FilterAndBrowseModel)
 
     Q_PROPERTY(QString query READ query WRITE setQuery NOTIFY queryChanged FINAL)
+    Q_PROPERTY(int queryDelay READ queryDelay WRITE setQueryDelay NOTIFY queryDelayChanged REVISION(6, 9) FINAL)
     Q_PROPERTY(QString contentType READ contentType WRITE setContentType NOTIFY contentTypeChanged FINAL)
     Q_PROPERTY(QStringList availableContentTypes READ availableContentTypes NOTIFY availableContentTypesChanged FINAL)
     Q_PROPERTY(bool canGoBack READ canGoBack NOTIFY canGoBackChanged FINAL)
+    Q_PROPERTY(int historySize READ historySize WRITE setHistorySize NOTIFY historySizeChanged REVISION(6, 9) FINAL)
 
 public:
 
@@ -45,6 +47,9 @@ public:
     QString query() const;
     void setQuery(const QString &query);
 
+    int queryDelay() const;
+    Q_REVISION(6, 9) void setQueryDelay(int queryDelay);
+
     QString contentType() const;
     void setContentType(const QString &contentType);
 
@@ -52,6 +57,9 @@ public:
 
     bool canGoBack() const;
 
+    int historySize() const;
+    Q_REVISION(6, 9) void setHistorySize(int historySize);
+
     QVariant data(const QModelIndex &index, int role) const override;
 
     QHash<int, QByteArray> roleNames() const override;
@@ -66,9 +74,12 @@ public:
 
 Q_SIGNALS:
     void queryChanged(const QString &query);
+    Q_REVISION(6, 9) void queryDelayChanged(int queryDelay);
     void contentTypeChanged(const QString &contentType);
     void availableContentTypesChanged(const QStringList &availableContentTypes);
     void canGoBackChanged(bool canGoBack);
+    Q_REVISION(6, 9) void historySizeChanged(int historySize);
+    Q_REVISION(6, 9) void historyRestored(int anchorIndex);
 
 protected:
     QIfFilterAndBrowseModel(QIfServiceObject *serviceObject, QObject *parent = nullptr);
@@ -26,19 +26,32 @@
 #include "qifstandarditem.h"
 
 #include <QBitArray>
+#include <QSharedPointer>
 #include <QUuid>
 
 QT_BEGIN_NAMESPACE
 
+class QTimer;
+
 class Q_QTINTERFACEFRAMEWORK_EXPORT QIfFilterAndBrowseModelPrivate : public QIfPagingModelPrivate
 {
 public:
     QIfFilterAndBrowseModelPrivate(const QString &interface, QIfFilterAndBrowseModel *model);
     ~QIfFilterAndBrowseModelPrivate() override;
 
+    struct ParsedQuery {
+        QString query;
+        QSet<QString> identifiers;
+        QSharedPointer<QIfAbstractQueryTerm> queryTerm;
+        QList<QIfOrderTerm> orderTerms;
+        QString error;
+    };
+
     void resetModel() override;
     void parseQuery();
-    void setupFilter(QIfAbstractQueryTerm* queryTerm, const QList<QIfOrderTerm> &orderTerms);
+    const ParsedQuery &parsedQuery(const QString &query);
+    void setupFilter(const QSharedPointer<QIfAbstractQueryTerm> &queryTerm, const QList<QIfOrderTerm> &orderTerms);
+    void onQueryTimeout();
     void clearToDefaults() override;
     void onCanGoForwardChanged(QUuid identifier, const QVector<bool> &indexes, int start);
     void onCanGoBackChanged(QUuid identifier, bool canGoBack);
@@ -48,14 +61,22 @@ public:
 
     QIfFilterAndBrowseModelInterface *searchBackend() const;
     void updateContentType(const QString &contentType);
+    void pushHistory(int anchorIndex);
+    bool restoreHistory();
+    void revalidateModel();
+    void trimHistory();
 
     QIfFilterAndBrowseModel * const q_ptr;
     Q_DECLARE_PUBLIC(QIfFilterAndBrowseModel)
 
     QString m_query;
 
-    QIfAbstractQueryTerm *m_queryTerm;
+    QSharedPointer<QIfAbstractQueryTerm> m_queryTerm;
     QList<QIfOrderTerm> m_orderTerms;
+    // The most recently used query is stored last
+    QList<ParsedQuery> m_parsedQueries;
+    int m_queryDelay;
+    QTimer *m_queryTimer;
 
     QString m_contentTypeRequested;
     QString m_contentType;
@@ -63,6 +84,27 @@ public:
     QSet<QString> m_queryIdentifiers;
     QVector<bool> m_canGoForward;
     bool m_canGoBack;
+
+    // A level of the navigation, as it was shown before going forward
+    struct HistoryEntry {
+        QString contentType;
+        QString query;
+        QSet<QString> queryIdentifiers;
+        QList<QVariant> itemList;
+        QBitArray availableChunks;
+        QList<int> recentlyUsedChunks;
+        QVector<bool> canGoForward;
+        QIfPagingModel::LoadingType loadingType = QIfPagingModel::FetchMore;
+        int chunkSize = 0;
+        int fetchedDataCount = 0;
+        int anchorIndex = -1;
+        bool moreAvailable = false;
+        bool canGoBack = false;
+    };
+
+    QList<HistoryEntry> m_history;
+    int m_historySize;
+    bool m_revalidating;
 };
 
 QT_END_NAMESPACE
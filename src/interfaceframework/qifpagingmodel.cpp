@@ -12,6 +12,9 @@
 #include <QDebug>
 #include <QMetaObject>
 
+#include <algorithm>
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 QIfPagingModelPrivate::QIfPagingModelPrivate(const QString &interface, QIfPagingModel *model)
@@ -19,6 +22,14 @@ QIfPagingModelPrivate::QIfPagingModelPrivate(const QString &interface, QIfPaging
     , q_ptr(model)
     , m_capabilities(QtInterfaceFrameworkModule::NoExtras)
     , m_chunkSize(30)
+    , m_fetchSequence(0)
+    , m_generation(0)
+    , m_fetchTimeout(10000)
+    , m_maxFetchRetries(2)
+    , m_cacheSize(0)
+    , m_prefetchChunks(0)
+    , m_lastAccessedChunk(-1)
+    , m_visibleChunks(1)
     , m_moreAvailable(false)
     , m_identifier(QUuid::createUuid())
     , m_fetchMoreThreshold(10)
@@ -50,6 +61,11 @@ void QIfPagingModelPrivate::initialize()
                      q, &QIfPagingModel::countChanged);
     QObjectPrivate::connect(q, &QIfPagingModel::fetchMoreThresholdReached,
                             this, &QIfPagingModelPrivate::onFetchMoreThresholdReached);
+
+    m_fetchTimer.setSingleShot(true);
+    m_fetchTimer.setTimerType(Qt::CoarseTimer);
+    QObjectPrivate::connect(&m_fetchTimer, &QTimer::timeout,
+                            this, &QIfPagingModelPrivate::checkPendingRequests);
 }
 
 void QIfPagingModelPrivate::onInitializationDone()
@@ -78,15 +94,63 @@ void QIfPagingModelPrivate::onCapabilitiesChanged(QUuid identifier, QtInterfaceF
     emit q->capabilitiesChanged(capabilities);
 }
 
-void QIfPagingModelPrivate::onDataFetched(QUuid identifier, const QList<QVariant> &items, int start, bool moreAvailable)
+void QIfPagingModelPrivate::onDataFetched(QUuid identifier, const QList<QVariant> &fetchedItems, int start, bool moreAvailable)
 {
-    if (!identifier.isNull() && (!items.count() || identifier != m_identifier))
+    if (!identifier.isNull() && identifier != m_identifier)
         return;
 
-    Q_ASSERT(items.count() <= m_chunkSize);
-    Q_ASSERT((start + items.count() - 1) / m_chunkSize == start / m_chunkSize);
+    //The reply doesn't say which request it answers. The replies for one chunk arrive in the order
+    //of the requests, which means the oldest request for this chunk is answered.
+    //Discard late replies for chunks which were evicted or requested before the model was reset.
+    if (!identifier.isNull()) {
+        const int chunkIndex = start / m_chunkSize;
+        quint64 sequence = 0;
+        const bool answered = takeSentRequest(chunkIndex, &sequence);
+        const auto it = m_pendingChunks.constFind(chunkIndex);
+        const bool current = answered && it != m_pendingChunks.cend() && it->sequence == sequence;
+        if (current)
+            m_pendingChunks.erase(it);
+        updateFetchTimer();
+        if (!current)
+            return;
+    }
+
+    if (!identifier.isNull() && !fetchedItems.count())
+        return;
+
+    Q_ASSERT(fetchedItems.count() <= m_chunkSize);
+    Q_ASSERT((start + fetchedItems.count() - 1) / m_chunkSize == start / m_chunkSize);
 
     Q_Q(QIfPagingModel);
+    const QList<QVariant> items = convertItems(fetchedItems);
+
+    if (m_loadingType == QIfPagingModel::FetchMore && start < m_itemList.count()) {
+        //The rows are already known, e.g. because they are revalidated after they were restored
+        //from a cache. Update them in place to keep the position of the views.
+        const int end = start + int(items.count());
+        const int updateCount = qMin(end, int(m_itemList.count())) - start;
+        if (updateCount > 0) {
+            std::copy(items.cbegin(), items.cbegin() + updateCount, m_itemList.begin() + start);
+            emit q->dataChanged(q->index(start), q->index(start + updateCount - 1));
+        }
+
+        if (end > m_itemList.count()) {
+            q->beginInsertRows(QModelIndex(), int(m_itemList.count()), end - 1);
+            m_itemList.append(items.mid(updateCount));
+            q->endInsertRows();
+        } else if (!moreAvailable && end < m_itemList.count()) {
+            q->beginRemoveRows(QModelIndex(), end, int(m_itemList.count()) - 1);
+            m_itemList.resize(end);
+            q->endRemoveRows();
+        }
+
+        //Only the reply for the last rows knows whether more data is available
+        m_fetchedDataCount = int(m_itemList.count());
+        if (end >= m_itemList.count())
+            m_moreAvailable = moreAvailable;
+        return;
+    }
+
     m_moreAvailable = moreAvailable;
 
     if (m_loadingType == QIfPagingModel::FetchMore) {
@@ -106,7 +170,11 @@ void QIfPagingModelPrivate::onDataFetched(QUuid identifier, const QList<QVariant
         for (int i = 0; i < items.count(); i++)
             m_itemList.replace(start + i, items.at(i));
 
-        m_availableChunks.setBit(start / m_chunkSize);
+        const int chunkIndex = start / m_chunkSize;
+        m_availableChunks.setBit(chunkIndex);
+        //Requested chunks are already tracked, prefetched ones need to stay behind the visible ones
+        if (!m_recentlyUsedChunks.contains(chunkIndex))
+            touchChunk(chunkIndex);
 
         emit q->dataChanged(q->index(start), q->index(start + int(items.count()) -1));
     }
@@ -118,15 +186,22 @@ void QIfPagingModelPrivate::onCountChanged(QUuid identifier, int new_length)
         return;
 
     Q_Q(QIfPagingModel);
-    q->beginInsertRows(QModelIndex(), int(m_itemList.count()), int(m_itemList.count() + new_length -1));
-    for (int i = 0; i < new_length; i++)
-        m_itemList.append(QVariant());
-    q->endInsertRows();
+    //The list is usually empty, but rows might have been restored from a cache before
+    const int count = int(m_itemList.count());
+    if (new_length > count) {
+        q->beginInsertRows(QModelIndex(), count, new_length - 1);
+        m_itemList.resize(new_length);
+        q->endInsertRows();
+    } else {
+        q->beginRemoveRows(QModelIndex(), new_length, count - 1);
+        m_itemList.resize(new_length);
+        q->endRemoveRows();
+    }
 
     m_availableChunks.resize(new_length / m_chunkSize + 1);
 }
 
-void QIfPagingModelPrivate::onDataChanged(QUuid identifier, const QList<QVariant> &data, int start, int count)
+void QIfPagingModelPrivate::onDataChanged(QUuid identifier, const QList<QVariant> &changedData, int start, int count)
 {
     if (!identifier.isNull() && identifier != m_identifier)
         return;
@@ -144,34 +219,36 @@ void QIfPagingModelPrivate::onDataChanged(QUuid identifier, const QList<QVariant
     }
 
     Q_Q(QIfPagingModel);
+    const QList<QVariant> data = convertItems(changedData);
 
     //delta > 0 insert rows
     //delta < 0 remove rows
     int delta = int(data.count()) - count;
     //find data overlap for updates
     int updateCount = qMin(int(data.count()), count);
-    int updateCountEnd = updateCount > 0 ? updateCount + 1 : 0;
     //range which is either added or removed
-    int insertRemoveStart = start + updateCountEnd;
+    int insertRemoveStart = start + updateCount;
     int insertRemoveCount = qMax(int(data.count()), count) - updateCount;
 
     if (updateCount > 0) {
-        for (int i = start, j=0; j < updateCount; i++, j++)
-            m_itemList.replace(i, data.at(j));
+        std::copy(data.cbegin(), data.cbegin() + updateCount, m_itemList.begin() + start);
         emit q->dataChanged(q->index(start), q->index(start + updateCount -1));
     }
 
+    //The whole range is removed or inserted at once, to keep this linear for big updates
     if (delta < 0) { //Remove
         q->beginRemoveRows(QModelIndex(), insertRemoveStart, insertRemoveStart + insertRemoveCount -1);
-        for (int i = insertRemoveStart; i < insertRemoveStart + insertRemoveCount; i++)
-            m_itemList.removeAt(i);
+        m_itemList.remove(insertRemoveStart, insertRemoveCount);
         q->endRemoveRows();
     } else if (delta > 0) { //Insert
         q->beginInsertRows(QModelIndex(), insertRemoveStart, insertRemoveStart + insertRemoveCount -1);
-        for (int i = insertRemoveStart, j = updateCountEnd; i < insertRemoveStart + insertRemoveCount; i++, j++)
-            m_itemList.insert(i, data.at(j));
+        m_itemList.insert(insertRemoveStart, insertRemoveCount, QVariant());
+        std::copy(data.cbegin() + updateCount, data.cend(), m_itemList.begin() + insertRemoveStart);
         q->endInsertRows();
     }
+
+    if (delta != 0 && m_loadingType == QIfPagingModel::DataChanged)
+        m_availableChunks.resize(m_itemList.count() / m_chunkSize + 1);
 }
 
 void QIfPagingModelPrivate::onFetchMoreThresholdReached()
@@ -187,6 +264,14 @@ void QIfPagingModelPrivate::resetModel()
     q->beginResetModel();
     m_itemList.clear();
     m_availableChunks.clear();
+    m_recentlyUsedChunks.clear();
+    m_pendingChunks.clear();
+    //Requests which were sent before the reset are kept until they are answered, to know which
+    //replies are outdated
+    m_generation++;
+    m_lastAccessedChunk = -1;
+    m_accessedChunks.clear();
+    m_visibleChunks = 1;
     m_fetchedDataCount = 0;
     //Setting this to true to let fetchMore do one first fetchcall.
     m_moreAvailable = true;
@@ -203,11 +288,225 @@ void QIfPagingModelPrivate::fetchData(int startIndex)
     m_moreAvailable = false;
     const int start = startIndex >= 0 ? startIndex : m_fetchedDataCount;
     const int chunkIndex = start / m_chunkSize;
-    if (chunkIndex < m_availableChunks.size())
+
+    //Drop duplicated requests for chunks which are still loading
+    if (m_pendingChunks.contains(chunkIndex))
+        return;
+
+    if (chunkIndex < m_availableChunks.size()) {
         m_availableChunks.setBit(chunkIndex);
+        touchChunk(chunkIndex);
+    }
+
+    m_pendingChunks.insert(chunkIndex, { start, 0, 0, QDeadlineTimer() });
+    sendFetchRequest(chunkIndex, start);
+}
+
+void QIfPagingModelPrivate::sendFetchRequest(int chunkIndex, int start)
+{
+    const quint64 sequence = ++m_fetchSequence;
+    const QDeadlineTimer deadline = m_fetchTimeout > 0 ? QDeadlineTimer(m_fetchTimeout)
+                                                       : QDeadlineTimer(QDeadlineTimer::Forever);
+
+    PendingRequest &request = m_pendingChunks[chunkIndex];
+    request.sequence = sequence;
+    request.deadline = deadline;
+    m_sentRequests[chunkIndex].append({ sequence, m_generation, deadline });
+    updateFetchTimer();
+
+    //The backend might reply synchronously, which modifies m_pendingChunks
     backend()->fetchData(m_identifier, start, m_chunkSize);
 }
 
+bool QIfPagingModelPrivate::takeSentRequest(int chunkIndex, quint64 *sequence)
+{
+    const auto it = m_sentRequests.find(chunkIndex);
+    if (it == m_sentRequests.end())
+        return false;
+
+    const SentRequest request = it->takeFirst();
+    if (it->isEmpty())
+        m_sentRequests.erase(it);
+
+    //Replies to requests from before the last reset are never used
+    if (request.generation != m_generation)
+        return false;
+
+    *sequence = request.sequence;
+    return true;
+}
+
+void QIfPagingModelPrivate::checkPendingRequests()
+{
+    //Requests which are not answered within the timeout are considered lost. Forgetting about
+    //them makes sure that the following replies are not attributed to them.
+    for (auto it = m_sentRequests.begin(); it != m_sentRequests.end();) {
+        it->removeIf([](const SentRequest &request) {
+            return request.deadline.hasExpired();
+        });
+        if (it->isEmpty())
+            it = m_sentRequests.erase(it);
+        else
+            ++it;
+    }
+
+    QList<std::pair<int, int>> retries;
+    for (auto it = m_pendingChunks.begin(); it != m_pendingChunks.end();) {
+        if (!it->deadline.hasExpired()) {
+            ++it;
+            continue;
+        }
+
+        if (backend() && it->retryCount < m_maxFetchRetries) {
+            it->retryCount++;
+            retries.append({ it.key(), it->start });
+            ++it;
+            continue;
+        }
+
+        qWarning() << "The backend didn't reply to the request for the rows starting at" << it->start
+                   << "after" << m_maxFetchRetries << "retries. Giving up.";
+
+        //Allow the chunk to be requested again the next time it is needed
+        if (it.key() < m_availableChunks.size())
+            m_availableChunks.clearBit(it.key());
+        if (m_loadingType == QIfPagingModel::FetchMore)
+            m_moreAvailable = true;
+        it = m_pendingChunks.erase(it);
+    }
+
+    for (const auto &retry : std::as_const(retries)) {
+        //An earlier synchronous reply might already have answered the chunk
+        if (m_pendingChunks.contains(retry.first))
+            sendFetchRequest(retry.first, retry.second);
+    }
+
+    updateFetchTimer();
+}
+
+void QIfPagingModelPrivate::updateFetchTimer()
+{
+    //Only the requests which are still waiting for a reply can time out
+    QDeadlineTimer earliest(QDeadlineTimer::Forever);
+    for (const QList<SentRequest> &requests : std::as_const(m_sentRequests)) {
+        for (const SentRequest &request : requests)
+            earliest = qMin(earliest, request.deadline);
+    }
+    for (const PendingRequest &request : std::as_const(m_pendingChunks))
+        earliest = qMin(earliest, request.deadline);
+
+    if (earliest.isForever()) {
+        m_fetchTimer.stop();
+        return;
+    }
+
+    m_fetchTimer.start(int(qBound<qint64>(0, earliest.remainingTime(), std::numeric_limits<int>::max())));
+}
+
+void QIfPagingModelPrivate::touchChunk(int chunkIndex)
+{
+    if (m_cacheSize <= 0 || m_loadingType != QIfPagingModel::DataChanged)
+        return;
+
+    //Most calls come from data() for rows of the chunk which was used last
+    if (!m_recentlyUsedChunks.isEmpty() && m_recentlyUsedChunks.constLast() == chunkIndex)
+        return;
+
+    m_recentlyUsedChunks.removeOne(chunkIndex);
+    m_recentlyUsedChunks.append(chunkIndex);
+
+    evictChunks();
+}
+
+void QIfPagingModelPrivate::evictChunks()
+{
+    if (m_cacheSize <= 0 || m_loadingType != QIfPagingModel::DataChanged) {
+        m_recentlyUsedChunks.clear();
+        return;
+    }
+
+    // Free the least recently used chunks. No dataChanged is emitted for them: the rows are
+    // refetched once data() is called for them again.
+    while (m_recentlyUsedChunks.count() > m_cacheSize) {
+        const int chunkIndex = m_recentlyUsedChunks.takeFirst();
+        if (chunkIndex < m_availableChunks.size())
+            m_availableChunks.clearBit(chunkIndex);
+        //A late reply for this chunk doesn't match any pending request anymore and is discarded
+        m_pendingChunks.remove(chunkIndex);
+
+        const int start = chunkIndex * m_chunkSize;
+        const int end = qMin(start + m_chunkSize, int(m_itemList.count()));
+        for (int i = start; i < end; i++)
+            m_itemList[i] = QVariant();
+    }
+}
+
+void QIfPagingModelPrivate::prefetch(int chunkIndex)
+{
+    if (m_prefetchChunks <= 0 || m_loadingType != QIfPagingModel::DataChanged)
+        return;
+
+    //Only look ahead once the view moved on to another chunk
+    if (chunkIndex == m_lastAccessedChunk)
+        return;
+
+    //Prefetch in the direction the view is scrolling
+    const int step = chunkIndex >= m_lastAccessedChunk ? 1 : -1;
+    m_lastAccessedChunk = chunkIndex;
+
+    int prefetchCount = m_prefetchChunks;
+    int lastChunk = chunkIndex;
+    if (m_cacheSize > 0) {
+        updateVisibleChunks(chunkIndex);
+
+        //Never prefetch more than the cache can hold next to the visible chunks, otherwise the
+        //view keeps evicting and refetching them
+        prefetchCount = qMin(prefetchCount, m_cacheSize - m_visibleChunks);
+        for (qsizetype i = m_accessedChunks.size() - m_visibleChunks; i < m_accessedChunks.size(); i++)
+            lastChunk = step > 0 ? qMax(lastChunk, m_accessedChunks.at(i)) : qMin(lastChunk, m_accessedChunks.at(i));
+    }
+
+    for (int i = 1; i <= prefetchCount; i++) {
+        const int nextChunk = lastChunk + i * step;
+        if (nextChunk < 0 || nextChunk >= m_availableChunks.size() || nextChunk * m_chunkSize >= m_itemList.count())
+            break;
+
+        //Chunks are marked as available once they are requested, which makes sure
+        //that chunks which are already loaded or pending are not requested twice
+        if (m_availableChunks.testBit(nextChunk) || m_pendingChunks.contains(nextChunk))
+            continue;
+
+        m_availableChunks.setBit(nextChunk);
+        //The prefetched chunks are not used yet and are freed before the visible chunks
+        if (m_cacheSize > 0) {
+            m_recentlyUsedChunks.removeOne(nextChunk);
+            m_recentlyUsedChunks.insert(qMax(qsizetype(0), m_recentlyUsedChunks.size() - m_visibleChunks), nextChunk);
+            evictChunks();
+        }
+
+        m_pendingChunks.insert(nextChunk, { nextChunk * m_chunkSize, 0, 0, QDeadlineTimer() });
+        sendFetchRequest(nextChunk, nextChunk * m_chunkSize);
+    }
+}
+
+void QIfPagingModelPrivate::updateVisibleChunks(int chunkIndex)
+{
+    //A view showing the rows of several chunks reads them in turns. Going back to a chunk which
+    //was read before means that all chunks read since then are still visible. The chunk which was
+    //read before the current one is usually still partly visible as well.
+    const qsizetype accessedIndex = m_accessedChunks.indexOf(chunkIndex);
+    if (accessedIndex >= 0) {
+        m_visibleChunks = int(m_accessedChunks.size() - accessedIndex);
+        m_accessedChunks.remove(accessedIndex);
+    }
+    m_accessedChunks.append(chunkIndex);
+
+    while (m_accessedChunks.size() > m_cacheSize)
+        m_accessedChunks.removeFirst();
+    const int accessedCount = int(m_accessedChunks.size());
+    m_visibleChunks = qBound(qMin(2, accessedCount), m_visibleChunks, accessedCount);
+}
+
 void QIfPagingModelPrivate::clearToDefaults()
 {
     Q_Q(QIfPagingModel);
@@ -216,8 +515,16 @@ void QIfPagingModelPrivate::clearToDefaults()
     emit q->chunkSizeChanged(m_chunkSize);
     m_moreAvailable = false;
     m_identifier = QUuid::createUuid();
+    //Replies for the old identifier are ignored anyway
+    m_sentRequests.clear();
     m_fetchMoreThreshold = 10;
     emit q->fetchMoreThresholdChanged(m_fetchMoreThreshold);
+    m_cacheSize = 0;
+    emit q->cacheSizeChanged(m_cacheSize);
+    m_prefetchChunks = 0;
+    emit q->prefetchChunksChanged(m_prefetchChunks);
+    m_fetchTimeout = 10000;
+    emit q->fetchTimeoutChanged(m_fetchTimeout);
     m_fetchedDataCount = 0;
     m_loadingType = QIfPagingModel::FetchMore;
     emit q->loadingTypeChanged(m_loadingType);
@@ -231,9 +538,35 @@ void QIfPagingModelPrivate::clearToDefaults()
 const QIfStandardItem *QIfPagingModelPrivate::itemAt(int i) const
 {
     const QVariant &var = m_itemList.at(i);
+
+    //The rows of a QIfTypedPagingModel are converted to its type once they are received and can be
+    //accessed directly, without resolving the metatype for every row again.
+    if (m_itemCast && var.metaType() == m_itemMetaType)
+        return m_itemCast(var.constData());
+
     return qtif_gadgetFromVariant<QIfStandardItem>(q_ptr, var);
 }
 
+//Converts all items which are not of the type set by setItemMetaType(), e.g. because the backend
+//provides them as a different but convertible type. Items which can't be converted are kept as they are.
+QList<QVariant> QIfPagingModelPrivate::convertItems(const QList<QVariant> &items) const
+{
+    if (!m_itemCast)
+        return items;
+
+    QList<QVariant> convertedItems = items;
+    for (qsizetype i = 0; i < convertedItems.count(); i++) {
+        const QVariant &var = std::as_const(convertedItems).at(i);
+        if (!var.isValid() || var.metaType() == m_itemMetaType || !var.canConvert(m_itemMetaType))
+            continue;
+
+        QVariant convertedItem = var;
+        if (convertedItem.convert(m_itemMetaType))
+            convertedItems[i] = convertedItem;
+    }
+    return convertedItems;
+}
+
 QIfPagingModelInterface *QIfPagingModelPrivate::backend() const
 {
     return QIfAbstractFeatureListModelPrivate::backend<QIfPagingModelInterface*>();
@@ -563,6 +896,168 @@ void QIfPagingModel::setLoadingType(QIfPagingModel::LoadingType loadingType)
     d->resetModel();
 }
 
+/*!
+    \qmlproperty int PagingModel::cacheSize
+    \brief Holds the maximum number of chunks which are kept in memory.
+    \since 6.9
+
+    By default, this property is \c 0, which means that all fetched chunks are kept until the
+    model is reset.
+
+    If set to a positive value, the least recently used chunks are freed once more than
+    cacheSize chunks have been fetched. A freed chunk is fetched again from the backend the next
+    time one of its rows is accessed. This keeps the memory usage of the model constant, no matter
+    how big the list provided by the backend is.
+
+    The value needs to be big enough to hold all chunks which are visible at the same time,
+    otherwise the model keeps refetching the same chunks.
+
+    \note This property is only used when loadingType is set to DataChanged.
+*/
+
+/*!
+    \property QIfPagingModel::cacheSize
+    \brief Holds the maximum number of chunks which are kept in memory.
+    \since 6.9
+
+    By default, this property is \c 0, which means that all fetched chunks are kept until the
+    model is reset.
+
+    If set to a positive value, the least recently used chunks are freed once more than
+    cacheSize chunks have been fetched. A freed chunk is fetched again from the backend the next
+    time one of its rows is accessed. This keeps the memory usage of the model constant, no matter
+    how big the list provided by the backend is.
+
+    The value needs to be big enough to hold all chunks which are visible at the same time,
+    otherwise the model keeps refetching the same chunks.
+
+    \note This property is only used when loadingType is set to DataChanged.
+*/
+int QIfPagingModel::cacheSize() const
+{
+    Q_D(const QIfPagingModel);
+    return d->m_cacheSize;
+}
+
+void QIfPagingModel::setCacheSize(int cacheSize)
+{
+    Q_D(QIfPagingModel);
+    if (d->m_cacheSize == cacheSize)
+        return;
+
+    // Chunks fetched while the cache was unbounded are not tracked yet
+    if (d->m_cacheSize <= 0) {
+        d->m_recentlyUsedChunks.clear();
+        for (qsizetype i = 0; i < d->m_availableChunks.size(); i++) {
+            if (d->m_availableChunks.testBit(i))
+                d->m_recentlyUsedChunks.append(int(i));
+        }
+    }
+
+    d->m_cacheSize = cacheSize;
+    emit cacheSizeChanged(cacheSize);
+
+    d->evictChunks();
+}
+
+/*!
+    \qmlproperty int PagingModel::prefetchChunks
+    \brief Holds the number of chunks which are fetched ahead of the currently accessed chunk.
+    \since 6.9
+
+    By default, this property is \c 0, which means that chunks are only fetched once one of their
+    rows is accessed.
+
+    If set to a positive value, the model requests up to prefetchChunks chunks ahead of the chunk
+    which is currently shown, in the direction the view is scrolling. This avoids showing empty
+    delegates while the data is fetched from a slow or remote backend. Chunks which are already
+    available or requested are not fetched again.
+
+    If a cacheSize is set, the number of prefetched chunks is limited to fit into the cache next to
+    the chunks which are currently shown. The prefetched chunks are freed before the shown ones.
+
+    \note This property is only used when loadingType is set to DataChanged.
+*/
+
+/*!
+    \property QIfPagingModel::prefetchChunks
+    \brief Holds the number of chunks which are fetched ahead of the currently accessed chunk.
+    \since 6.9
+
+    By default, this property is \c 0, which means that chunks are only fetched once one of their
+    rows is accessed.
+
+    If set to a positive value, the model requests up to prefetchChunks chunks ahead of the chunk
+    which is currently shown, in the direction the view is scrolling. This avoids showing empty
+    delegates while the data is fetched from a slow or remote backend. Chunks which are already
+    available or requested are not fetched again.
+
+    If a cacheSize is set, the number of prefetched chunks is limited to fit into the cache next to
+    the chunks which are currently shown. The prefetched chunks are freed before the shown ones.
+
+    \note This property is only used when loadingType is set to DataChanged.
+*/
+int QIfPagingModel::prefetchChunks() const
+{
+    Q_D(const QIfPagingModel);
+    return d->m_prefetchChunks;
+}
+
+void QIfPagingModel::setPrefetchChunks(int prefetchChunks)
+{
+    Q_D(QIfPagingModel);
+    if (d->m_prefetchChunks == prefetchChunks)
+        return;
+
+    d->m_prefetchChunks = prefetchChunks;
+    emit prefetchChunksChanged(prefetchChunks);
+}
+
+/*!
+    \qmlproperty int PagingModel::fetchTimeout
+    \brief Holds the time in milliseconds the model waits for the backend to provide a chunk.
+    \since 6.9
+
+    By default, this property is \c 10000.
+
+    If the backend doesn't provide the requested rows within this time, the request is sent again.
+    After two retries the model gives up and requests the rows again the next time they are
+    needed. Replies which arrive after the timeout are still used, as long as the rows were not
+    requested again.
+
+    A value of \c 0 or less disables the timeout.
+*/
+
+/*!
+    \property QIfPagingModel::fetchTimeout
+    \brief Holds the time in milliseconds the model waits for the backend to provide a chunk.
+    \since 6.9
+
+    By default, this property is \c 10000.
+
+    If the backend doesn't provide the requested rows within this time, the request is sent again.
+    After two retries the model gives up and requests the rows again the next time they are
+    needed. Replies which arrive after the timeout are still used, as long as the rows were not
+    requested again.
+
+    A value of \c 0 or less disables the timeout.
+*/
+int QIfPagingModel::fetchTimeout() const
+{
+    Q_D(const QIfPagingModel);
+    return d->m_fetchTimeout;
+}
+
+void QIfPagingModel::setFetchTimeout(int fetchTimeout)
+{
+    Q_D(QIfPagingModel);
+    if (d->m_fetchTimeout == fetchTimeout)
+        return;
+
+    d->m_fetchTimeout = fetchTimeout;
+    emit fetchTimeoutChanged(fetchTimeout);
+}
+
 /*!
     \qmlproperty int PagingModel::count
     \brief Holds the current number of rows in this model.
@@ -599,9 +1094,15 @@ QVariant QIfPagingModel::data(const QModelIndex &index, int role) const
     if (d->m_loadingType == DataChanged && !d->m_availableChunks.at(chunkIndex)) {
         //qWarning() << "Cache miss: Fetching Data for index " << row << "and following";
         const_cast<QIfPagingModelPrivate*>(d)->fetchData(chunkIndex * d->m_chunkSize);
+        const_cast<QIfPagingModelPrivate*>(d)->prefetch(chunkIndex);
         return QVariant();
     }
 
+    if (d->m_loadingType == DataChanged) {
+        const_cast<QIfPagingModelPrivate*>(d)->touchChunk(chunkIndex);
+        const_cast<QIfPagingModelPrivate*>(d)->prefetch(chunkIndex);
+    }
+
     if (row >= d->m_fetchedDataCount - d->m_fetchMoreThreshold && canFetchMore(QModelIndex()))
         emit const_cast<QIfPagingModel*>(this)->fetchMoreThresholdReached();
 
@@ -763,6 +1264,47 @@ void QIfPagingModel::clearServiceObject()
     d->clearToDefaults();
 }
 
+/*!
+    \internal
+
+    Tells the model that all rows are expected to be of the type \a metaType, which needs to be
+    derived from QIfStandardItem. Rows of a different type are converted to \a metaType when they
+    are received, if QMetaType knows a conversion. The \a itemCast function returns the
+    QIfStandardItem of a value of type \a metaType.
+
+    This is used by QIfTypedPagingModel to avoid resolving the type of every row.
+*/
+void QIfPagingModel::setItemMetaType(QMetaType metaType, ItemCastFunction itemCast)
+{
+    Q_D(QIfPagingModel);
+    d->m_itemMetaType = metaType;
+    d->m_itemCast = itemCast;
+}
+
+/*!
+    \class QIfTypedPagingModel
+    \inmodule QtInterfaceFramework
+    \brief The QIfTypedPagingModel is a QIfPagingModel which expects all rows to be of one type.
+    \since 6.9
+
+    All rows of the model are expected to be of the type \c T, which needs to be derived from
+    QIfStandardItem. The rows are still stored as QVariant, but rows provided by the backend as a
+    different type are converted to \c T when they are received, if QMetaType knows a conversion.
+    Rows of the type \c T are accessed directly, without looking up the type of the stored value.
+    Rows which can't be converted are handled like in a QIfPagingModel.
+
+    The QIfTypedPagingModel is used by the code generated by the \l{Qt Interface Framework Generator}
+    for all model properties.
+*/
+
+/*!
+    \fn template <typename T> QIfTypedPagingModel<T>::QIfTypedPagingModel(QObject *parent)
+
+    Constructs a QIfTypedPagingModel.
+
+    The \a parent argument is passed on to the \l QIfPagingModel base class.
+*/
+
 /*!
     \fn void QIfPagingModel::fetchMoreThresholdReached()
 
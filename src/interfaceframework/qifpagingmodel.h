@@ -13,6 +13,7 @@
 QT_BEGIN_NAMESPACE
 
 class QIfPagingModelPrivate;
+class QIfStandardItem;
 
 class Q_QTINTERFACEFRAMEWORK_EXPORT QIfPagingModel : public QIfAbstractFeatureListModel
 {
@@ -23,6 +24,9 @@ class Q_QTINTERFACEFRAMEWORK_EXPORT QIfPagingModel : public QIfAbstractFeatureLi
     Q_PROPERTY(int chunkSize READ chunkSize WRITE setChunkSize NOTIFY chunkSizeChanged FINAL)
     Q_PROPERTY(int fetchMoreThreshold READ fetchMoreThreshold WRITE setFetchMoreThreshold NOTIFY fetchMoreThresholdChanged FINAL)
     Q_PROPERTY(int count READ rowCount NOTIFY countChanged FINAL)
+    Q_PROPERTY(int cacheSize READ cacheSize WRITE setCacheSize NOTIFY cacheSizeChanged REVISION(6, 9) FINAL)
+    Q_PROPERTY(int prefetchChunks READ prefetchChunks WRITE setPrefetchChunks NOTIFY prefetchChunksChanged REVISION(6, 9) FINAL)
+    Q_PROPERTY(int fetchTimeout READ fetchTimeout WRITE setFetchTimeout NOTIFY fetchTimeoutChanged REVISION(6, 9) FINAL)
 
     //TODO fix naming
     Q_PROPERTY(QIfPagingModel::LoadingType loadingType READ loadingType WRITE setLoadingType NOTIFY loadingTypeChanged FINAL)
@@ -56,6 +60,15 @@ public:
     QIfPagingModel::LoadingType loadingType() const;
     void setLoadingType(QIfPagingModel::LoadingType loadingType);
 
+    int cacheSize() const;
+    Q_REVISION(6, 9) void setCacheSize(int cacheSize);
+
+    int prefetchChunks() const;
+    Q_REVISION(6, 9) void setPrefetchChunks(int prefetchChunks);
+
+    int fetchTimeout() const;
+    Q_REVISION(6, 9) void setFetchTimeout(int fetchTimeout);
+
     int rowCount(const QModelIndex &parent = QModelIndex()) const override;
     QVariant data(const QModelIndex &index, int role) const override;
 
@@ -78,6 +91,9 @@ Q_SIGNALS:
     void fetchMoreThresholdChanged(int fetchMoreThreshold);
     void fetchMoreThresholdReached();
     void loadingTypeChanged(QIfPagingModel::LoadingType loadingType);
+    Q_REVISION(6, 9) void cacheSizeChanged(int cacheSize);
+    Q_REVISION(6, 9) void prefetchChunksChanged(int prefetchChunks);
+    Q_REVISION(6, 9) void fetchTimeoutChanged(int fetchTimeout);
 
 protected:
     QIfPagingModel(QIfServiceObject *serviceObject, QObject *parent = nullptr);
@@ -85,6 +101,8 @@ protected:
     void connectToServiceObject(QIfServiceObject *serviceObject) override;
     void disconnectFromServiceObject(QIfServiceObject *serviceObject) override;
     void clearServiceObject() override;
+    using ItemCastFunction = const QIfStandardItem *(*)(const void *);
+    void setItemMetaType(QMetaType metaType, ItemCastFunction itemCast);
 
 private:
     Q_DECLARE_PRIVATE(QIfPagingModel)
@@ -25,6 +25,9 @@
 #include "qifstandarditem.h"
 
 #include <QtCore/QBitArray>
+#include <QtCore/QDeadlineTimer>
+#include <QtCore/QHash>
+#include <QtCore/QTimer>
 #include <QtCore/QUuid>
 
 QT_BEGIN_NAMESPACE
@@ -45,24 +48,62 @@ public:
     virtual void resetModel();
     virtual void clearToDefaults();
     const QIfStandardItem *itemAt(int i) const;
+    QList<QVariant> convertItems(const QList<QVariant> &items) const;
     void fetchData(int startIndex);
+    void sendFetchRequest(int chunkIndex, int start);
+    bool takeSentRequest(int chunkIndex, quint64 *sequence);
+    void checkPendingRequests();
+    void updateFetchTimer();
+    void touchChunk(int chunkIndex);
+    void evictChunks();
+    void prefetch(int chunkIndex);
+    void updateVisibleChunks(int chunkIndex);
 
     QIfPagingModelInterface *backend() const;
 
     QIfPagingModel * const q_ptr;
     Q_DECLARE_PUBLIC(QIfPagingModel)
 
+    struct PendingRequest {
+        int start = 0;
+        int retryCount = 0;
+        quint64 sequence = 0;
+        QDeadlineTimer deadline;
+    };
+
+    // A call to QIfPagingModelInterface::fetchData() which wasn't answered yet
+    struct SentRequest {
+        quint64 sequence = 0;
+        quint64 generation = 0;
+        QDeadlineTimer deadline;
+    };
+
     QtInterfaceFrameworkModule::ModelCapabilities m_capabilities;
     int m_chunkSize;
 
     QList<QVariant> m_itemList;
     QBitArray m_availableChunks;
+    QList<int> m_recentlyUsedChunks;
+    QHash<int, PendingRequest> m_pendingChunks;
+    QHash<int, QList<SentRequest>> m_sentRequests;
+    quint64 m_fetchSequence;
+    quint64 m_generation;
+    QTimer m_fetchTimer;
+    int m_fetchTimeout;
+    int m_maxFetchRetries;
+    int m_cacheSize;
+    int m_prefetchChunks;
+    int m_lastAccessedChunk;
+    QList<int> m_accessedChunks;
+    int m_visibleChunks;
     bool m_moreAvailable;
 
     QUuid m_identifier;
     int m_fetchMoreThreshold;
     int m_fetchedDataCount;
     QIfPagingModel::LoadingType m_loadingType;
+    QMetaType m_itemMetaType;
+    QIfPagingModel::ItemCastFunction m_itemCast = nullptr;
 };
 
 QT_END_NAMESPACE
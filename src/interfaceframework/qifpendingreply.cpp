@@ -11,7 +11,10 @@
 #include "private/qjsvalue_p.h"
 
 #include <QDebug>
+#include <QHash>
 #include <QJSEngine>
+#include <QReadWriteLock>
+#include <QThread>
 #include <QtQml>
 #include <QCoreApplication>
 
@@ -61,7 +64,88 @@ void qifRegisterPendingReplyBasicTypes() {
 
 Q_COREAPP_STARTUP_FUNCTION(qifRegisterPendingReplyBasicTypes)
 
-// TODO make it reentrant
+namespace {
+
+// How values passed to setSuccess() are validated for a specific reply type
+struct QIfPendingReplyValidation
+{
+    QMetaType metaType;
+    // Valid if the type is an enum or flag, which needs a range check instead of a type check
+    QMetaEnum metaEnum;
+};
+
+struct QIfPendingReplyValidationCache
+{
+    QReadWriteLock lock;
+    QHash<int, QIfPendingReplyValidation> validations;
+};
+
+Q_GLOBAL_STATIC(QIfPendingReplyValidationCache, pendingReplyValidationCache)
+
+QIfPendingReplyValidation resolvePendingReplyValidation(int userType)
+{
+    QIfPendingReplyValidation validation;
+    validation.metaType = QMetaType(userType);
+
+    const QMetaObject *mo = validation.metaType.metaObject();
+    if (mo) {
+        const QByteArrayView typeName(validation.metaType.name());
+        const qsizetype scopeIndex = typeName.lastIndexOf("::");
+        const QByteArray enumName = (scopeIndex == -1 ? typeName : typeName.sliced(scopeIndex + 2)).toByteArray();
+        validation.metaEnum = mo->enumerator(mo->indexOfEnumerator(enumName.constData()));
+    }
+    return validation;
+}
+
+QIfPendingReplyValidation pendingReplyValidation(int userType)
+{
+    QIfPendingReplyValidationCache *cache = pendingReplyValidationCache();
+    {
+        QReadLocker locker(&cache->lock);
+        const auto it = cache->validations.constFind(userType);
+        if (it != cache->validations.cend())
+            return *it;
+    }
+
+    // Types which were not registered using qIfRegisterPendingReplyType() are resolved once on
+    // first use
+    const QIfPendingReplyValidation validation = resolvePendingReplyValidation(userType);
+    QWriteLocker locker(&cache->lock);
+    cache->validations.insert(userType, validation);
+    return validation;
+}
+
+} // namespace
+
+/*!
+    \internal
+
+    Registers how the values of a QIfPendingReply with the type \a metaType are validated. If the
+    type is an enum or a flag, \a metaEnum is used to check the range of the values.
+
+    This is called by qIfRegisterPendingReplyType() and makes sure the validation doesn't need to be
+    resolved whenever a reply of this type succeeds.
+*/
+void qtif_private::registerPendingReplyValidation(QMetaType metaType, const QMetaEnum &metaEnum)
+{
+    QIfPendingReplyValidationCache *cache = pendingReplyValidationCache();
+    QWriteLocker locker(&cache->lock);
+    cache->validations.insert(metaType.id(), QIfPendingReplyValidation { metaType, metaEnum });
+}
+
+namespace {
+
+// The last copy of a reply might be released in a different thread than the one the watcher
+// lives in
+void deleteWatcher(QIfPendingReplyWatcher *watcher)
+{
+    if (watcher->thread() != QThread::currentThread())
+        watcher->deleteLater();
+    else
+        delete watcher;
+}
+
+} // namespace
 
 QIfPendingReplyWatcherPrivate::QIfPendingReplyWatcherPrivate(int userType, QIfPendingReplyWatcher *parent)
     : QObjectPrivate()
@@ -89,9 +173,62 @@ void QIfPendingReplyWatcherPrivate::setSuccess(const QVariant &value)
     emit q->valueChanged(value);
     emit q->replySuccess();
 
+    callCallbacks();
     callSuccessCallback();
 }
 
+void QIfPendingReplyWatcherPrivate::setFailed()
+{
+    Q_Q(QIfPendingReplyWatcher);
+
+    if (m_resultAvailable) {
+        qWarning("Result is already set. Ignoring request");
+        return;
+    }
+
+    m_resultAvailable = true;
+    //emitting valueChanged is intended here as it makes it easier to react to successful and failed
+    //replies in the same slot.
+    emit q->valueChanged(m_data);
+    emit q->replyFailed();
+
+    callCallbacks();
+    callFailedCallback();
+}
+
+/*!
+    \internal
+
+    Calls the C++ callbacks added using then(), once the result is available.
+
+    Like the callbacks connected to the signals of the watcher before, the callbacks are always
+    called in the thread the watcher lives in, which is the thread the reply was created in. If
+    the result is set from a different thread, the call is queued to the watcher and the callbacks
+    are not touched from the calling thread.
+*/
+void QIfPendingReplyWatcherPrivate::callCallbacks()
+{
+    Q_Q(QIfPendingReplyWatcher);
+
+    if (q->thread() != QThread::currentThread()) {
+        QMetaObject::invokeMethod(q, [this]() {
+            callCallbacks();
+        }, Qt::QueuedConnection);
+        return;
+    }
+
+    // The callbacks are only called once, releasing them also releases everything they captured
+    const auto successCallbacks = std::exchange(m_successCallbacks, {});
+    const auto failedCallbacks = std::exchange(m_failedCallbacks, {});
+    if (m_success) {
+        for (const auto &callback : successCallbacks)
+            callback(m_data);
+    } else {
+        for (const auto &callback : failedCallbacks)
+            callback();
+    }
+}
+
 void QIfPendingReplyWatcherPrivate::callSuccessCallback()
 {
     if (!m_successFunctor.isUndefined() && m_callbackEngine) {
@@ -119,6 +256,10 @@ void QIfPendingReplyWatcherPrivate::callFailedCallback()
     between copies of the same QIfPendingReply instance. At the same time the watcher provides
     signals for when a result is ready or an error happened.
 
+    The watcher lives in the thread the QIfPendingReply was created in. The callbacks passed to
+    QIfPendingReply::then() are always called in this thread, even if the result is set from a
+    different thread.
+
     A QIfPendingReplyWatcher cannot be instantiated on its own. It is always created from a
     QIfPendingReply internally.
 */
@@ -449,34 +590,25 @@ void QIfPendingReplyWatcher::setSuccess(const QVariant &value)
         return;
     }
 
+    const QIfPendingReplyValidation validation = pendingReplyValidation(d->m_type);
     QVariant var = value;
 
-    //We need a special conversion for enums from QML as they are saved as int
-    QMetaType metaType(d->m_type);
-    bool isEnumOrFlag = false;
-
     //Try to convert the value, if successfully, use the converted value
-    QVariant temp(var);
-    if (temp.convert(metaType))
-        var = temp;
-
-
-    const QMetaObject *mo = metaType.metaObject();
-    const QString enumName = QString::fromLocal8Bit(metaType.name()).split(u"::"_s).last();
-    if (mo) {
-        QMetaEnum mEnum = mo->enumerator(mo->indexOfEnumerator(enumName.toLocal8Bit().constData()));
-        if (mEnum.isValid()) {
-            isEnumOrFlag = true;
-            if (!mEnum.isFlag() && !mEnum.valueToKey(var.toInt())) {
-                qtif_qmlOrCppWarning(this, "Enum value out of range");
-                return;
-            }
-        }
+    if (var.metaType() != validation.metaType) {
+        QVariant temp(var);
+        if (temp.convert(validation.metaType))
+            var = temp;
     }
 
-    //Check that the type names match only if it's not a enum, as it will be converted automatically in this case.
-    if (!isEnumOrFlag && var.metaType() != metaType) {
-        qtif_qmlOrCppWarning(this, QString(u"Expected: %1 but got %2"_s).arg(QLatin1String(metaType.name()), QLatin1String(var.metaType().name())));
+    //We need a special conversion for enums from QML as they are saved as int
+    if (validation.metaEnum.isValid()) {
+        if (!validation.metaEnum.isFlag() && !validation.metaEnum.valueToKey(var.toInt())) {
+            qtif_qmlOrCppWarning(this, "Enum value out of range");
+            return;
+        }
+    } else if (var.metaType() != validation.metaType) {
+        //Check that the type names match only if it's not a enum, as it will be converted automatically in this case.
+        qtif_qmlOrCppWarning(this, QString(u"Expected: %1 but got %2"_s).arg(QLatin1String(validation.metaType.name()), QLatin1String(var.metaType().name())));
         return;
     }
 
@@ -493,18 +625,7 @@ void QIfPendingReplyWatcher::setSuccess(const QVariant &value)
 void QIfPendingReplyWatcher::setFailed()
 {
     Q_D(QIfPendingReplyWatcher);
-    if (d->m_resultAvailable) {
-        qWarning("Result is already set. Ignoring request");
-        return;
-    }
-
-    d->m_resultAvailable = true;
-    //emitting valueChanged is intended here as it makes it easier to react to successful and failed
-    //replies in the same slot.
-    emit valueChanged(d->m_data);
-    emit replyFailed();
-
-    d->callFailedCallback();
+    d->setFailed();
 }
 
 /*!
@@ -549,19 +670,19 @@ void QIfPendingReplyWatcher::then(const QJSValue &success, const QJSValue &faile
 }
 
 QIfPendingReplyBase::QIfPendingReplyBase(int userType)
-    : m_watcher(new QIfPendingReplyWatcher(userType))
+    : m_watcher(new QIfPendingReplyWatcher(userType), &deleteWatcher)
 {
     qifRegisterPendingReplyBasicTypes();
 }
 
 QIfPendingReplyBase::QIfPendingReplyBase(const QIfPendingReplyBase &other)
+    : m_watcher(other.m_watcher)
 {
-    this->m_watcher = other.m_watcher;
 }
 
 QIfPendingReplyBase::QIfPendingReplyBase(const QIfPendingReplyBase && other)
+    : m_watcher(other.m_watcher)
 {
-    this->m_watcher = std::move(other.m_watcher);
 }
 
 /*!
@@ -715,8 +836,11 @@ void QIfPendingReplyBase::then(const QJSValue &success, const QJSValue &failed)
 */
 void QIfPendingReplyBase::setSuccess(const QVariant &value)
 {
-    if (m_watcher)
-        m_watcher->setSuccess(value);
+    if (m_watcher) {
+        // Keep the watcher alive, in case the callbacks release the last reply referencing it
+        const QSharedPointer<QIfPendingReplyWatcher> watcher = m_watcher;
+        watcher->setSuccess(value);
+    }
 }
 
 /*!
@@ -737,8 +861,10 @@ void QIfPendingReplyBase::setSuccess(const QVariant &value)
 */
 void QIfPendingReplyBase::setFailed()
 {
-    if (m_watcher)
-        m_watcher->setFailed();
+    if (m_watcher) {
+        const QSharedPointer<QIfPendingReplyWatcher> watcher = m_watcher;
+        watcher->setFailed();
+    }
 }
 
 /*!
@@ -750,8 +876,45 @@ void QIfPendingReplyBase::setFailed()
 */
 void QIfPendingReplyBase::setSuccessNoCheck(const QVariant &value)
 {
-    if (m_watcher)
-        m_watcher->d_func()->setSuccess(value);
+    if (m_watcher) {
+        const QSharedPointer<QIfPendingReplyWatcher> watcher = m_watcher;
+        watcher->d_func()->setSuccess(value);
+    }
+}
+
+/*!
+    \internal
+
+    Adds the \a success and \a failed callbacks, which are called once a result is set. In contrast
+    to connecting to the signals of the watcher, this doesn't create a connection per callback.
+
+    The callbacks are only accessed from the thread the watcher lives in. If this is called from a
+    different thread, adding them is queued.
+*/
+void QIfPendingReplyBase::addCallbacks(const std::function<void(const QVariant &)> &success, const std::function<void()> &failed)
+{
+    if (!m_watcher)
+        return;
+
+    auto d = m_watcher->d_func();
+    auto add = [d, success, failed]() {
+        if (success)
+            d->m_successCallbacks.push_back(success);
+        if (failed)
+            d->m_failedCallbacks.push_back(failed);
+    };
+
+    if (m_watcher->thread() == QThread::currentThread()) {
+        add();
+        return;
+    }
+
+    QMetaObject::invokeMethod(m_watcher.data(), [d, add]() {
+        add();
+        // The result might have been set in the meantime
+        if (d->m_resultAvailable)
+            d->callCallbacks();
+    }, Qt::QueuedConnection);
 }
 
 /*!
@@ -844,6 +1007,9 @@ void QIfPendingReplyBase::setSuccessNoCheck(const QVariant &value)
     In case the result of the pending reply is already available when this function is called, the corresponding callback functions are
     run immediately.
 
+    The callbacks are called in the thread the reply was created in. If the result is set from a
+    different thread, the call is queued to the event loop of that thread.
+
     \sa QIfPendingReplyBase::then
 */
 
@@ -14,6 +14,8 @@
 #include <QtCore/QMetaEnum>
 #include <QtQml/QQmlEngine>
 
+#include <functional>
+
 #include <QtInterfaceFramework/qtifglobal.h>
 
 QT_BEGIN_NAMESPACE
@@ -22,6 +24,10 @@ class QIfPendingReplyWatcherPrivate;
 
 Q_QTINTERFACEFRAMEWORK_EXPORT void qifRegisterPendingReplyBasicTypes();
 
+namespace qtif_private {
+    Q_QTINTERFACEFRAMEWORK_EXPORT void registerPendingReplyValidation(QMetaType metaType, const QMetaEnum &metaEnum = QMetaEnum());
+}
+
 // AXIVION Next Line Qt-CtorMissingParentArgument: private ctor
 class Q_QTINTERFACEFRAMEWORK_EXPORT QIfPendingReplyWatcher : public QObject
 {
@@ -83,6 +89,7 @@ public:
 
 protected:
     void setSuccessNoCheck(const QVariant & value);
+    void addCallbacks(const std::function<void(const QVariant &)> &success, const std::function<void()> &failed);
 
     QSharedPointer<QIfPendingReplyWatcher> m_watcher;
 };
@@ -120,15 +127,13 @@ public:
             else if (failed)
                 failed();
         } else {
-            QWeakPointer<QIfPendingReplyWatcher> w = m_watcher;
+            std::function<void(const QVariant &)> successCallback;
             if (success) {
-                QObject::connect(watcher(), &QIfPendingReplyWatcher::replySuccess, watcher(), [success, w]() {
-                    if (w)
-                        success(w.toStrongRef()->value().value<T>());
-                });
+                successCallback = [success](const QVariant &value) {
+                    success(value.template value<T>());
+                };
             }
-            if (failed)
-                QObject::connect(watcher(), &QIfPendingReplyWatcher::replyFailed, watcher(), failed);
+            addCallbacks(successCallback, failed);
         }
     }
 
@@ -167,15 +172,7 @@ public:
             else if (failed)
                 failed();
         } else {
-            QWeakPointer<QIfPendingReplyWatcher> w = m_watcher;
-            if (success) {
-                QObject::connect(watcher(), &QIfPendingReplyWatcher::replySuccess, watcher(), [success, w]() {
-                    if (w)
-                        success(w.toStrongRef()->value());
-                });
-            }
-            if (failed)
-                QObject::connect(watcher(), &QIfPendingReplyWatcher::replyFailed, watcher(), failed);
+            addCallbacks(success, failed);
         }
     }
 
@@ -210,10 +207,10 @@ public:
             else if (failed)
                 failed();
         } else {
+            std::function<void(const QVariant &)> successCallback;
             if (success)
-                QObject::connect(watcher(), &QIfPendingReplyWatcher::replySuccess, watcher(), success);
-            if (failed)
-                QObject::connect(watcher(), &QIfPendingReplyWatcher::replyFailed, watcher(), failed);
+                successCallback = [success](const QVariant &) { success(); };
+            addCallbacks(successCallback, failed);
         }
     }
 
@@ -243,6 +240,7 @@ template <typename T> Q_INLINE_TEMPLATE typename std::enable_if<QtPrivate::IsQEn
 
     const QString t_name = QLatin1String("QIfPendingReply<") + n + QLatin1String(">");
     qRegisterMetaType<QIfPendingReplyBase>(qPrintable(t_name));
+    qtif_private::registerPendingReplyValidation(QMetaType::fromType<T>(), QMetaEnum::fromType<T>());
 }
 
 //If T is NOT a enum
@@ -252,6 +250,7 @@ template <typename T> Q_INLINE_TEMPLATE typename std::enable_if<!QtPrivate::IsQE
     const char* n = name ? name : QMetaType(qMetaTypeId<T>()).name();
     const QString t_name = QLatin1String("QIfPendingReply<") + QLatin1String(n) + QLatin1String(">");
     qRegisterMetaType<QIfPendingReplyBase>(qPrintable(t_name));
+    qtif_private::registerPendingReplyValidation(QMetaType::fromType<T>());
 }
 
 #define QIF_DECLARE_PENDINGREPLY(TYPE) \
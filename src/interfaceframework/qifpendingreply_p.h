@@ -22,6 +22,8 @@
 
 #include "qifpendingreply.h"
 
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 
 class Q_QTINTERFACEFRAMEWORK_EXPORT QIfPendingReplyWatcherPrivate : public QObjectPrivate
@@ -30,6 +32,8 @@ public:
     QIfPendingReplyWatcherPrivate(int userType, QIfPendingReplyWatcher *parent);
 
     void setSuccess(const QVariant &value);
+    void setFailed();
+    void callCallbacks();
     void callSuccessCallback();
     void callFailedCallback();
 
@@ -41,6 +45,9 @@ public:
     bool m_resultAvailable;
     bool m_success;
     QVariant m_data;
+    // Only accessed from the thread the watcher lives in
+    std::vector<std::function<void(const QVariant &)>> m_successCallbacks;
+    std::vector<std::function<void()>> m_failedCallbacks;
     QJSValue m_successFunctor;
     QJSValue m_failedFunctor;
     QJSEngine *m_callbackEngine;
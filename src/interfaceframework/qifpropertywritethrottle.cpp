@@ -0,0 +1,176 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qifpropertywritethrottle_p.h"
+
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QTimer>
+
+using namespace Qt::StringLiterals;
+
+QT_BEGIN_NAMESPACE
+
+Q_LOGGING_CATEGORY(qLcIfWriteThrottle, "qt.if.writethrottle")
+
+/*!
+    \class QIfPropertyWriteThrottle
+    \internal
+
+    Limits the number of writes of a property to the backend.
+
+    Every property uses one of the following policies:
+
+    \value Immediate
+           Every write is forwarded to the backend right away.
+    \value Coalesce
+           The first write is forwarded right away. All writes within the following interval are
+           merged and only the latest value is forwarded once the interval elapsed.
+    \value CommitOnIdle
+           Only the latest value is forwarded, once no new value was written for the interval.
+*/
+QIfPropertyWriteThrottle::QIfPropertyWriteThrottle(QObject *parent)
+    : QObject(parent)
+{
+}
+
+void QIfPropertyWriteThrottle::setPolicy(const QString &property, Policy policy, int interval)
+{
+    if (policy != Immediate && interval <= 0) {
+        qCWarning(qLcIfWriteThrottle, "The write policy of property '%s' needs an interval greater than 0. Using 'immediate' instead.",
+                  qPrintable(property));
+        policy = Immediate;
+    }
+
+    auto it = m_entries.find(property);
+    if (policy == Immediate) {
+        if (it == m_entries.end())
+            return;
+        // Make sure the last value still reaches the backend
+        auto pending = std::move(it->pending);
+        delete it->timer;
+        m_entries.erase(it);
+        if (pending)
+            pending();
+        return;
+    }
+
+    if (it == m_entries.end()) {
+        it = m_entries.insert(property, Entry());
+        it->timer = new QTimer(this);
+        it->timer->setSingleShot(true);
+        connect(it->timer, &QTimer::timeout, this, [this, property]() {
+            onTimeout(property);
+        });
+    }
+    it->policy = policy;
+    it->timer->setInterval(interval);
+}
+
+/*!
+    Applies the \a policies, which map a property name to a QVariantMap containing the \c policy
+    and the \c interval in milliseconds.
+*/
+void QIfPropertyWriteThrottle::setPolicies(const QVariantMap &policies)
+{
+    for (auto it = policies.cbegin(); it != policies.cend(); ++it) {
+        const QVariantMap settings = it.value().toMap();
+        bool ok = false;
+        const Policy policy = policyFromString(settings.value(u"policy"_s).toString(), &ok);
+        if (!ok) {
+            qCWarning(qLcIfWriteThrottle, "Ignoring malformed write policy for property '%s'. Possible values are: 'immediate', 'coalesce', 'commitOnIdle'",
+                      qPrintable(it.key()));
+            continue;
+        }
+        setPolicy(it.key(), policy, settings.value(u"interval"_s).toInt());
+    }
+}
+
+/*!
+    Forwards the write of \a property to \a commit, according to the policy of the property.
+*/
+void QIfPropertyWriteThrottle::write(const QString &property, const std::function<void()> &commit)
+{
+    auto it = m_entries.find(property);
+    if (it == m_entries.end()) {
+        commit();
+        return;
+    }
+
+    if (it->policy == Coalesce && !it->timer->isActive()) {
+        commit();
+        it->timer->start();
+        return;
+    }
+
+    it->pending = commit;
+    if (it->policy == CommitOnIdle)
+        it->timer->start();
+}
+
+/*!
+    Returns whether a write of \a property is waiting to be forwarded to the backend.
+
+    The generated setters use this to decide whether a value which matches the current value
+    still needs to be written, as it replaces a different pending value.
+*/
+bool QIfPropertyWriteThrottle::isPending(const QString &property) const
+{
+    const auto it = m_entries.constFind(property);
+    return it != m_entries.cend() && it->pending;
+}
+
+/*!
+    Forwards all pending writes right away.
+*/
+void QIfPropertyWriteThrottle::flush()
+{
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        it->timer->stop();
+        if (auto pending = std::move(it->pending)) {
+            it->pending = nullptr;
+            pending();
+        }
+    }
+}
+
+/*!
+    Drops all pending writes, e.g. because the backend is no longer available.
+*/
+void QIfPropertyWriteThrottle::discard()
+{
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        it->timer->stop();
+        it->pending = nullptr;
+    }
+}
+
+QIfPropertyWriteThrottle::Policy QIfPropertyWriteThrottle::policyFromString(const QString &policy, bool *ok)
+{
+    if (ok)
+        *ok = true;
+    if (policy.compare(u"coalesce"_s, Qt::CaseInsensitive) == 0)
+        return Coalesce;
+    if (policy.compare(u"commitOnIdle"_s, Qt::CaseInsensitive) == 0)
+        return CommitOnIdle;
+    if (ok)
+        *ok = policy.compare(u"immediate"_s, Qt::CaseInsensitive) == 0;
+    return Immediate;
+}
+
+void QIfPropertyWriteThrottle::onTimeout(const QString &property)
+{
+    auto it = m_entries.find(property);
+    if (it == m_entries.end() || !it->pending)
+        return;
+
+    auto pending = std::move(it->pending);
+    it->pending = nullptr;
+    // Keep the minimum interval between two writes
+    if (it->policy == Coalesce)
+        it->timer->start();
+    pending();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qifpropertywritethrottle_p.cpp"
@@ -0,0 +1,67 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIFPROPERTYWRITETHROTTLE_P_H
+#define QIFPROPERTYWRITETHROTTLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QVariantMap>
+
+#include <functional>
+
+#include <private/qtifglobal_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QTimer;
+
+class Q_QTINTERFACEFRAMEWORK_EXPORT QIfPropertyWriteThrottle : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Policy {
+        Immediate,
+        Coalesce,
+        CommitOnIdle
+    };
+
+    explicit QIfPropertyWriteThrottle(QObject *parent = nullptr);
+
+    void setPolicy(const QString &property, Policy policy, int interval);
+    void setPolicies(const QVariantMap &policies);
+
+    void write(const QString &property, const std::function<void()> &commit);
+    bool isPending(const QString &property) const;
+    void flush();
+    void discard();
+
+    static Policy policyFromString(const QString &policy, bool *ok = nullptr);
+
+private:
+    struct Entry {
+        Policy policy = Immediate;
+        QTimer *timer = nullptr;
+        std::function<void()> pending;
+    };
+
+    void onTimeout(const QString &property);
+
+    QHash<QString, Entry> m_entries;
+};
+
+QT_END_NAMESPACE
+
+#endif // QIFPROPERTYWRITETHROTTLE_P_H
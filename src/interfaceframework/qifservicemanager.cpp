@@ -11,15 +11,25 @@
 #include "qifconfiguration_p.h"
 
 #include <QAbstractEventDispatcher>
+#include <QCborArray>
+#include <QCborValue>
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDebug>
 #include <QDir>
+#include <QFile>
 #include <QJsonObject>
 #include <QLibrary>
 #include <QModelIndex>
+#include <QSaveFile>
+#include <QStandardPaths>
 #include <QStringList>
 #include <QThread>
 
+#ifdef Q_OS_UNIX
+#  include <sys/stat.h>
+#endif
+
 using namespace Qt::StringLiterals;
 
 #define QIF_PLUGIN_DIRECTORY "interfaceframework"
@@ -46,6 +56,13 @@ namespace qtif_helper {
     static const QString classNameLiteral = u"className"_s;
     static const QString simulationLiteral = u"simulation"_s;
     static const QString debugLiteral = u"debug"_s;
+    static const QString versionLiteral = u"version"_s;
+    static const QString directoriesLiteral = u"directories"_s;
+    static const QString filesLiteral = u"files"_s;
+    static const QString mtimeLiteral = u"mtime"_s;
+    static const QString stampLiteral = u"stamp"_s;
+    // Bump the format version whenever the layout of the plugin index changes
+    static const QString pluginIndexVersion = QStringLiteral("1:" QT_VERSION_STR);
 #ifdef Q_OS_WIN
     static const QString debugSuffixLiteral = u"d"_s;
 #else
@@ -68,6 +85,19 @@ namespace qtif_helper {
 
         return baseName;
     }
+
+    // Identifies a plugin file without opening it. The metaData of a plugin is only read again
+    // if one of the values changed.
+    QCborArray fileStamp(const QFileInfo &info)
+    {
+        qint64 inode = 0;
+#ifdef Q_OS_UNIX
+        struct stat statBuf;
+        if (::stat(QFile::encodeName(info.absoluteFilePath()).constData(), &statBuf) == 0)
+            inode = qint64(statBuf.st_ino);
+#endif
+        return { info.size(), info.lastModified().toMSecsSinceEpoch(), inode };
+    }
 }
 
 using namespace qtif_helper;
@@ -151,14 +181,11 @@ QList<QIfServiceObjectHandle> QIfServiceManagerPrivate::findServiceByInterface(c
     qCDebug(qLcIfServiceManagement) << "Searching for a backend for:" << interface << "SearchFlags:" << searchFlags << "PreferredBackends:" << preferredBackends;
 
     QList<Backend *> foundBackends;
-    for (Backend *backend : m_backends) {
-
-        if (backend->metaData[interfacesLiteral].toStringList().contains(interface)) {
-            bool isSimulation = QIfServiceManagerPrivate::isSimulation(backend->metaData);
-            if ((searchFlags & QIfServiceManager::IncludeSimulationBackends && isSimulation) ||
-                (searchFlags & QIfServiceManager::IncludeProductionBackends && !isSimulation)) {
-                foundBackends.append(backend);
-            }
+    const QList<Backend *> interfaceBackends = m_interfaceIndex.value(interface);
+    for (Backend *backend : interfaceBackends) {
+        if ((searchFlags & QIfServiceManager::IncludeSimulationBackends && backend->simulation) ||
+            (searchFlags & QIfServiceManager::IncludeProductionBackends && !backend->simulation)) {
+            foundBackends.append(backend);
         }
     }
 
@@ -168,11 +195,13 @@ QList<QIfServiceObjectHandle> QIfServiceManagerPrivate::findServiceByInterface(c
     // In case of no match the next wildcard is used.
     for (const QString &wildCard : std::as_const(preferredBackends)) {
         qCDebug(qLcIfServiceManagement) << "Dissambiguate found backends with wildcard:" << wildCard;
-        const auto regexp = QRegularExpression(QRegularExpression::wildcardToRegularExpression(wildCard));
+        auto regexpIt = m_wildcardCache.constFind(wildCard);
+        if (regexpIt == m_wildcardCache.cend())
+            regexpIt = m_wildcardCache.insert(wildCard, QRegularExpression(QRegularExpression::wildcardToRegularExpression(wildCard)));
+        const QRegularExpression &regexp = *regexpIt;
         for (Backend *backend : std::as_const(foundBackends)) {
-            const auto fileInfo = QFileInfo(backend->metaData[fileNameLiteral].toString());
             QIfServiceObjectHandle handle;
-            QString identifier = fileInfo.fileName();
+            QString identifier = backend->identifier;
 
             if (identifier.isEmpty() && backend->interface) {
                 //static plugin
@@ -212,6 +241,9 @@ void QIfServiceManagerPrivate::searchPlugins()
     QElapsedTimer timer;
     if (qLcIfPerf().isDebugEnabled())
         timer.start();
+    loadPluginIndex();
+    int cachedPlugins = 0;
+    int scannedPlugins = 0;
     const auto pluginDirs = QCoreApplication::libraryPaths();
     for (const QString &pluginDir : pluginDirs) {
         // Already loaded, skip it...
@@ -230,27 +262,73 @@ void QIfServiceManagerPrivate::searchPlugins()
         if (!dir.exists())
             continue;
 
-        const QStringList plugins = QDir(path).entryList(
+        // Files can only be added or removed by changing the modification time of the directory.
+        // As long as it didn't change, the list of plugins is taken from the index.
+        const qint64 dirModified = QFileInfo(path).lastModified().toMSecsSinceEpoch();
+        const QCborMap cachedDir = m_pluginIndex.value(directoriesLiteral).toMap().value(path).toMap();
+        const QCborMap cachedFiles = cachedDir.value(filesLiteral).toMap();
+
+        QStringList plugins;
+        if (!cachedDir.isEmpty() && cachedDir.value(mtimeLiteral).toInteger() == dirModified) {
+            for (auto it = cachedFiles.cbegin(); it != cachedFiles.cend(); ++it)
+                plugins.append(it.key().toString());
+        } else {
+            const QStringList files = QDir(path).entryList(
 #ifdef Q_OS_ANDROID
-                    QStringList(QLatin1String("libplugins_%1_*.so").arg(QLatin1String(QIF_PLUGIN_DIRECTORY))),
+                        QStringList(QLatin1String("libplugins_%1_*.so").arg(QLatin1String(QIF_PLUGIN_DIRECTORY))),
 #endif
-                    QDir::Files);
-        for (const QString &pluginFileName : plugins) {
-            if (!QLibrary::isLibrary(pluginFileName)) {
-                qCDebug(qLcIfServiceManagement) << "Skipping:" << pluginFileName;
-                continue;
+                        QDir::Files);
+            for (const QString &pluginFileName : files) {
+                if (!QLibrary::isLibrary(pluginFileName)) {
+                    qCDebug(qLcIfServiceManagement) << "Skipping:" << pluginFileName;
+                    continue;
+                }
+                plugins.append(pluginFileName);
             }
-            qCDebug(qLcIfServiceManagement) << "Found:" << pluginFileName;
+        }
 
+        QCborMap indexedFiles;
+        for (const QString &pluginFileName : std::as_const(plugins)) {
             const QFileInfo info(dir, pluginFileName);
             const QString absFile = info.canonicalFilePath();
-            QPluginLoader loader(absFile);
+            if (absFile.isEmpty())
+                continue;
+            qCDebug(qLcIfServiceManagement) << "Found:" << pluginFileName;
 
-            registerBackend(absFile, loader.metaData());
+            const QCborArray stamp = fileStamp(info);
+            const QCborMap cachedFile = cachedFiles.value(pluginFileName).toMap();
+            QJsonObject metaData;
+            if (!cachedFile.isEmpty() && cachedFile.value(stampLiteral).toArray() == stamp) {
+                metaData = cachedFile.value(metaDataLiteral).toJsonValue().toObject();
+                cachedPlugins++;
+            } else {
+                QPluginLoader loader(absFile);
+                metaData = loader.metaData();
+                scannedPlugins++;
+            }
+
+            indexedFiles.insert(pluginFileName, QCborMap {
+                { stampLiteral, stamp },
+                { metaDataLiteral, QCborValue::fromJsonValue(metaData) }
+            });
+
+            registerBackend(absFile, metaData);
             found = true;
         }
+
+        if (cachedDir.value(mtimeLiteral).toInteger() != dirModified || cachedFiles != indexedFiles) {
+            QCborMap directories = m_pluginIndex.value(directoriesLiteral).toMap();
+            directories.insert(path, QCborMap {
+                { mtimeLiteral, dirModified },
+                { filesLiteral, indexedFiles }
+            });
+            m_pluginIndex.insert(directoriesLiteral, directories);
+            m_pluginIndexDirty = true;
+        }
     }
 
+    savePluginIndex();
+
     // Only load the static plugins once
     if (!m_staticLoaded) {
         qCDebug(qLcIfServiceManagement) << "Searching for static backend plugins";
@@ -262,11 +340,63 @@ void QIfServiceManagerPrivate::searchPlugins()
         }
     }
 
-    qCDebug(qLcIfPerf) << "Searching for backend plugins done in" << timer.elapsed() << "ms";
+    qCDebug(qLcIfPerf) << "Searching for backend plugins done in" << timer.elapsed() << "ms"
+                       << "(" << cachedPlugins << "taken from the plugin index," << scannedPlugins << "scanned )";
     if (Q_UNLIKELY(!found && m_backends.count() == 0))
         qWarning() << "No plugins found in search path: " << QCoreApplication::libraryPaths().join(QLatin1String(":"));
 }
 
+/*!
+    \internal
+
+    Loads the index of all known plugins and their metadata, which is stored in the cache location
+    of the application. Setting the QTIF_DISABLE_PLUGIN_INDEX environment variable disables the
+    index and all plugins are scanned on every start.
+*/
+void QIfServiceManagerPrivate::loadPluginIndex()
+{
+    if (m_pluginIndexLoaded)
+        return;
+    m_pluginIndexLoaded = true;
+
+    if (qEnvironmentVariableIsSet("QTIF_DISABLE_PLUGIN_INDEX"))
+        return;
+
+    const QString cacheLocation = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (cacheLocation.isEmpty())
+        return;
+    m_pluginIndexFile = cacheLocation + u"/qtinterfaceframework/pluginindex.cbor"_s;
+
+    QFile file(m_pluginIndexFile);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    const QCborMap index = QCborValue::fromCbor(file.readAll()).toMap();
+    if (index.value(versionLiteral).toString() != pluginIndexVersion) {
+        qCDebug(qLcIfServiceManagement) << "Ignoring outdated plugin index:" << m_pluginIndexFile;
+        return;
+    }
+    qCDebug(qLcIfServiceManagement) << "Using plugin index:" << m_pluginIndexFile;
+    m_pluginIndex = index;
+}
+
+void QIfServiceManagerPrivate::savePluginIndex()
+{
+    if (!m_pluginIndexDirty || m_pluginIndexFile.isEmpty())
+        return;
+    m_pluginIndexDirty = false;
+
+    m_pluginIndex.insert(versionLiteral, pluginIndexVersion);
+
+    QDir().mkpath(QFileInfo(m_pluginIndexFile).absolutePath());
+    QSaveFile file(m_pluginIndexFile);
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(m_pluginIndex.toCborValue().toCbor()) == -1
+        || !file.commit()) {
+        qCDebug(qLcIfServiceManagement) << "Failed to write the plugin index:" << m_pluginIndexFile;
+    }
+}
+
 void QIfServiceManagerPrivate::registerBackend(const QString &fileName, const QJsonObject &metaData)
 {
     QVariantMap backendMetaData = metaData.value(metaDataLiteral).toVariant().toMap();
@@ -354,7 +484,7 @@ void QIfServiceManagerPrivate::unloadAllBackends()
     m_backends.clear();
     q->endResetModel();
 
-    m_interfaceNames.clear();
+    m_interfaceIndex.clear();
     m_loadedPaths.clear();
     m_staticLoaded = false;
 }
@@ -370,11 +500,14 @@ void QIfServiceManagerPrivate::addBackend(Backend *backend)
     const QStringList ifaceList = backend->metaData.value(interfacesLiteral).toStringList();
     const QSet<QString> newInterfaces = QSet<QString>(ifaceList.begin(), ifaceList.end());
 
+    backend->simulation = QIfServiceManagerPrivate::isSimulation(backend->metaData);
+    backend->identifier = QFileInfo(newBackendFile).fileName();
+
     bool addBackend = true;
     if (!newBackendFile.isEmpty()) {
         for (int i = 0; i < m_backends.count(); i++) {
             Backend *b = m_backends[i];
-            const QStringList curIfaceList = backend->metaData.value(interfacesLiteral).toStringList();
+            const QStringList curIfaceList = b->metaData.value(interfacesLiteral).toStringList();
             const QSet<QString> interfaces = QSet<QString>(curIfaceList.begin(), curIfaceList.end());
             if (interfaces == newInterfaces && b->name == backend->name) {
                 const QString fileName = b->metaData.value(fileNameLiteral).toString();
@@ -394,6 +527,7 @@ void QIfServiceManagerPrivate::addBackend(Backend *backend)
                         qCDebug(qLcIfServiceManagement, "Replacing backend %s with %s", qPrintable(fileName), qPrintable(newBackendFile));
                         addBackend = false;
                         m_backends[i] = backend;
+                        rebuildInterfaceIndex();
                         emit q->dataChanged(q->index(i, 0), q->index(i, 0));
                         delete b;
                         break;
@@ -407,14 +541,26 @@ void QIfServiceManagerPrivate::addBackend(Backend *backend)
     }
     if (addBackend) {
         qCDebug(qLcIfServiceManagement, "Adding %s %s", qPrintable(newBackendFile.isEmpty() ? backend->name : newBackendFile),
-                QIfServiceManagerPrivate::isSimulation(backend->metaData) ? "as simulation backend" : "as production backend");
+                backend->simulation ? "as simulation backend" : "as production backend");
         q->beginInsertRows(QModelIndex(), int(m_backends.count()), int(m_backends.count()));
         m_backends.append(backend);
+        for (const QString &interface : newInterfaces)
+            m_interfaceIndex[interface].append(backend);
         q->endInsertRows();
     }
+}
 
-    for (const QString &interface : newInterfaces)
-        m_interfaceNames.insert(interface);
+void QIfServiceManagerPrivate::rebuildInterfaceIndex()
+{
+    m_interfaceIndex.clear();
+    for (Backend *backend : std::as_const(m_backends)) {
+        const QStringList interfaces = backend->metaData.value(interfacesLiteral).toStringList();
+        for (const QString &interface : interfaces) {
+            QList<Backend *> &backends = m_interfaceIndex[interface];
+            if (!backends.contains(backend))
+                backends.append(backend);
+        }
+    }
 }
 
 namespace {
@@ -893,7 +1039,7 @@ void QIfServiceManager::unloadAllBackends()
 bool QIfServiceManager::hasInterface(const QString &interface) const
 {
     Q_D(const QIfServiceManager);
-    return d->m_interfaceNames.contains(interface);
+    return d->m_interfaceIndex.contains(interface);
 }
 
 /*!
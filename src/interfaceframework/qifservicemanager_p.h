@@ -18,9 +18,12 @@
 //
 
 #include <QtCore/QAbstractListModel>
+#include <QtCore/QCborMap>
+#include <QtCore/QHash>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QMap>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QRegularExpression>
 #include <QtCore/QSet>
 #include <QtCore/QStringList>
 #include <QtCore/QVariantMap>
@@ -44,6 +47,8 @@ struct Backend {
 
     QString name;
     bool debug = false;
+    bool simulation = false;
+    QString identifier;
     QVariantMap metaData;
     QIfServiceInterface *interface = nullptr;
     QIfProxyServiceObject *proxyServiceObject = nullptr;
@@ -66,10 +71,13 @@ public:
     QList<QIfServiceObjectHandle> findServiceByInterface(const QString &interface, QIfServiceManager::SearchFlags searchFlags, const QStringList &preferredBackends) const;
 
     void searchPlugins();
+    void loadPluginIndex();
+    void savePluginIndex();
     void registerStaticBackend(const QStaticPlugin &plugin);
     void registerBackend(const QString &fileName, const QJsonObject &metaData);
     bool registerBackend(QObject *serviceBackendInterface, const QStringList &interfaces, QIfServiceManager::BackendType backendType);
     void addBackend(struct Backend *backend);
+    void rebuildInterfaceIndex();
 
     void unloadAllBackends();
 
@@ -80,9 +88,15 @@ public:
     Backend *verifyHandle(void *handle);
 
     QList<Backend*> m_backends;
-    QSet<QString> m_interfaceNames;
+    // All backends implementing an interface, in the same order as in m_backends
+    QHash<QString, QList<Backend*>> m_interfaceIndex;
+    mutable QHash<QString, QRegularExpression> m_wildcardCache;
     QStringList m_loadedPaths;
     bool m_staticLoaded;
+    QString m_pluginIndexFile;
+    QCborMap m_pluginIndex;
+    bool m_pluginIndexLoaded = false;
+    bool m_pluginIndexDirty = false;
 
     QIfServiceManager * const q_ptr;
     Q_DECLARE_PUBLIC(QIfServiceManager)
@@ -247,8 +247,8 @@ QIfSimulationEngine::QIfSimulationEngine(const QString &identifier, QObject *par
 /*!
     Loads the simulation data file provided as \a dataFile.
 
-    The given file must be in JSON format and is parsed here for errors before it's passed to the
-    IfSimulator global object where it can be accessed from QML. This file can be overridden
+    The given file must be in JSON or CBOR format and is parsed here for errors before it's passed
+    to the IfSimulator global object where it can be accessed from QML. This file can be overridden
     at runtime using the following environment variable:
 
     \badcode
@@ -257,6 +257,11 @@ QIfSimulationEngine::QIfSimulationEngine(const QString &identifier, QObject *par
 
     The simulation engine's identifier can be set in its constructor.
 
+    Since 6.9, files with the \c .cbor suffix or starting with the CBOR self-describe tag are read
+    as CBOR. These files are memory mapped if possible and the data of an interface is only decoded
+    once it is requested from QML. To map a file from the resource system, it needs to be stored
+    without compression. The simulation backends generated by \l ifcodegen use this format.
+
     \sa IfSimulator
 */
 void QIfSimulationEngine::loadSimulationData(const QString &dataFile)
@@ -269,14 +274,29 @@ void QIfSimulationEngine::loadSimulationData(const QString &dataFile)
 
     qCDebug(qLcIfSimulationEngine, "loading SimulationData for engine %s: %s", qPrintable(m_identifier), qPrintable(filePath));
 
-    QFile file(filePath);
-    if (!file.open(QFile::ReadOnly)) {
-        qCCritical(qLcIfSimulationEngine, "Cannot open the simulation data file %s: %s", qPrintable(filePath), qPrintable(file.errorString()));
+    auto file = std::make_unique<QFile>(filePath);
+    if (!file->open(QFile::ReadOnly)) {
+        qCCritical(qLcIfSimulationEngine, "Cannot open the simulation data file %s: %s", qPrintable(filePath), qPrintable(file->errorString()));
+        return;
+    }
+
+    if (filePath.endsWith(u".cbor"_s, Qt::CaseInsensitive) || file->peek(3) == QByteArrayView("\xd9\xd9\xf7")) {
+        QByteArray data;
+        if (uchar *mapped = file->map(0, file->size())) {
+            data = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), file->size());
+        } else {
+            data = file->readAll();
+            file.reset();
+        }
+
+        const QCborError error = m_globalObject->setCborSimulationData(data, std::move(file));
+        if (error != QCborError::NoError)
+            qCCritical(qLcIfSimulationEngine, "Error parsing the simulation data in %s: %s", qPrintable(filePath), qPrintable(error.toString()));
         return;
     }
 
     QJsonParseError pe;
-    QByteArray data = file.readAll();
+    QByteArray data = file->readAll();
     QJsonDocument document = QJsonDocument::fromJson(data, &pe);
     if (pe.error != QJsonParseError::NoError) {
         qCCritical(qLcIfSimulationEngine, "Error parsing the simulation data in %s: %s", qPrintable(filePath), qPrintable(pe.errorString()));
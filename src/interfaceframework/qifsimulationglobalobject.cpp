@@ -5,7 +5,10 @@
 
 #include "qifsimulationglobalobject_p.h"
 #include <QtDebug>
+#include <QCborStreamReader>
+#include <QCborValue>
 #include <QJsonDocument>
+#include <QSet>
 
 using namespace Qt::StringLiterals;
 
@@ -23,6 +26,38 @@ namespace qtif_helper {
 
 using namespace qtif_helper;
 
+namespace {
+
+// The CBOR self-describe tag, which is written in front of generated simulation data
+constexpr char cborSignature[] = "\xd9\xd9\xf7";
+
+template <typename Container>
+QString findDataKey(const Container &data, const QString &interface)
+{
+    QString key = interface;
+    forever {
+        if (data.contains(key))
+            return key;
+
+        qsizetype index = key.indexOf(QLatin1Char('.'));
+        if (index == -1)
+            break;
+        key = key.right(key.size() - index - 1);
+    }
+
+    return QString();
+}
+
+QByteArray stripCborSignature(const QByteArray &data)
+{
+    if (!data.startsWith(cborSignature))
+        return data;
+    const qsizetype signatureSize = sizeof(cborSignature) - 1;
+    return QByteArray::fromRawData(data.constData() + signatureSize, data.size() - signatureSize);
+}
+
+} // namespace
+
 /*!
       \qmlmodule IfSimulator 1.0
       \internal
@@ -45,7 +80,7 @@ using namespace qtif_helper;
 
     The IfSimulator expects its data already in a parsed form. Usually this is done by the
     QIfSimulationEngine::loadSimulationData() function, which expects the file to be in the JSON
-    format.
+    or CBOR format. The structure described below is the same for both formats.
 
     \section2 Interfaces
 
@@ -239,12 +274,61 @@ QIfSimulationGlobalObject::QIfSimulationGlobalObject(QObject *parent)
 */
 QVariant QIfSimulationGlobalObject::simulationData() const
 {
+    // CBOR data is only decoded completely if it's accessed as a whole
+    if (!m_cborData.isNull() && !m_simulationData.isValid())
+        m_simulationData = QCborValue::fromCbor(stripCborSignature(m_cborData)).toVariant();
     return m_simulationData;
 }
 
 void QIfSimulationGlobalObject::setSimulationData(const QVariant &simulationData)
 {
     m_simulationData = simulationData;
+    m_cborData.clear();
+    m_cborFile.reset();
+    m_cborInterfaces.clear();
+    m_decodedInterfaces.clear();
+    m_constraints.clear();
+    m_interfaceKeys.clear();
+}
+
+/*!
+    \internal
+
+    Sets the simulation data from its CBOR encoded form in \a data.
+
+    Only the top-level map is indexed here, the data of a single interface is decoded once it is
+    requested. \a data is not copied and can point to the memory mapping of \a mappedFile, which is
+    kept alive until new simulation data is set.
+*/
+QCborError QIfSimulationGlobalObject::setCborSimulationData(const QByteArray &data, std::unique_ptr<QFile> mappedFile)
+{
+    setSimulationData(QVariant());
+
+    const QByteArray content = stripCborSignature(data);
+    QHash<QString, QByteArray> interfaces;
+    QCborStreamReader reader(content);
+    if (!reader.isMap())
+        return reader.lastError() != QCborError::NoError ? reader.lastError() : QCborError { QCborError::IllegalType };
+
+    reader.enterContainer();
+    while (reader.lastError() == QCborError::NoError && reader.hasNext()) {
+        if (!reader.isString())
+            return QCborError { QCborError::IllegalType };
+        const QString key = reader.readAllString();
+        const qint64 start = reader.currentOffset();
+        if (!reader.next())
+            break;
+        interfaces.insert(key, QByteArray::fromRawData(content.constData() + start, reader.currentOffset() - start));
+    }
+    if (reader.lastError() == QCborError::NoError)
+        reader.leaveContainer();
+    if (reader.lastError() != QCborError::NoError)
+        return reader.lastError();
+
+    m_cborData = data;
+    m_cborFile = std::move(mappedFile);
+    m_cborInterfaces = std::move(interfaces);
+    return QCborError { QCborError::NoError };
 }
 
 /*!
@@ -267,18 +351,28 @@ void QIfSimulationGlobalObject::setSimulationData(const QVariant &simulationData
 */
 QVariantMap QIfSimulationGlobalObject::findData(const QVariantMap &data, const QString &interface)
 {
-    QString key = interface;
-    forever {
-        if (data.contains(key))
-            return data.value(key).toMap();
+    const QString key = findDataKey(data, interface);
+    if (key.isNull())
+        return QVariantMap();
+    return data.value(key).toMap();
+}
 
-        qsizetype index = key.indexOf(QLatin1Char('.'));
-        if (index == -1)
-            break;
-        key = key.right(key.size() - index - 1);
-    }
+/*!
+    \qmlmethod var IfSimulator::findInterfaceData(string interface)
+    \since 6.9
+
+    Returns the data stored for \a interface within the simulation data. The key is searched in
+    the same way as in findData().
 
-    return QVariantMap();
+    In contrast to \c {findData(IfSimulator.simulationData, interface)}, this only decodes the data
+    of the requested \a interface if the simulation data was loaded from a CBOR file.
+*/
+QVariantMap QIfSimulationGlobalObject::findInterfaceData(const QString &interface)
+{
+    const QString key = interfaceKey(interface);
+    if (key.isNull())
+        return QVariantMap();
+    return interfaceData(key);
 }
 
 /*!
@@ -346,33 +440,7 @@ QVariant QIfSimulationGlobalObject::defaultValue(const QVariantMap &data, const
 */
 QString QIfSimulationGlobalObject::constraint(const QVariantMap &data, const QString &zone)
 {
-    const QVariant unsupportedDomain = parseDomainValue(data, unsupportedLiteral, zone);
-    QVariant minDomain = parseDomainValue(data, minLiteral, zone);
-    QVariant maxDomain = parseDomainValue(data, maxLiteral, zone);
-    const QVariant rangeDomain = parseDomainValue(data, rangeLiteral, zone);
-    if (rangeDomain.isValid()) {
-        QVariantList range = rangeDomain.toList();
-        if (range.count() == 2) {
-            minDomain = range.at(0);
-            maxDomain = range.at(1);
-        } else {
-            qtif_qmlOrCppWarning(this, "Domain 'range' needs to be list of exactly two values");
-        }
-    }
-    const QVariant domainDomain = parseDomainValue(data, domainLiteral, zone);
-
-    if (unsupportedDomain.isValid())
-        return unsupportedLiteral;
-    if (minDomain.isValid() && maxDomain.isValid())
-        return u"["_s + minDomain.toString() + u"-"_s + maxDomain.toString() + u"]"_s ;
-    if (minDomain.isValid())
-        return u">= "_s + minDomain.toString();
-    if (maxDomain.isValid())
-        return u"<= "_s + maxDomain.toString();
-    if (domainDomain.isValid())
-        return QString::fromUtf8(QJsonDocument::fromVariant(domainDomain).toJson(QJsonDocument::Compact));
-
-    return QString();
+    return constraintString(compileConstraint(data, zone));
 }
 
 /*!
@@ -388,62 +456,7 @@ QString QIfSimulationGlobalObject::constraint(const QVariantMap &data, const QSt
 */
 bool QIfSimulationGlobalObject::checkSettings(const QVariantMap &data, const QVariant &value, const QString &zone)
 {
-    const QVariant unsupportedDomain = parseDomainValue(data, unsupportedLiteral, zone);
-    QVariant minDomain = parseDomainValue(data, minLiteral, zone);
-    QVariant maxDomain = parseDomainValue(data, maxLiteral, zone);
-    const QVariant rangeDomain = parseDomainValue(data, rangeLiteral, zone);
-    if (rangeDomain.isValid()) {
-        QVariantList range = rangeDomain.toList();
-        if (range.isEmpty())
-            return true;
-
-        if (range.count() == 2) {
-            minDomain = range.at(0);
-            maxDomain = range.at(1);
-        } else {
-            qtif_qmlOrCppWarning(this, "Domain 'range' needs to be list of exactly two values");
-            return false;
-        }
-    }
-    const QVariant domainDomain = parseDomainValue(data, domainLiteral, zone);
-    bool doubleValueOk = false;
-    double doubleValue = value.toDouble(&doubleValueOk);
-    bool minDomainDoubleOk = false;
-    double minDomainDouble = minDomain.toDouble(&minDomainDoubleOk);
-    bool maxDomainDoubleOk = false;
-    double maxDomainDouble = maxDomain.toDouble(&maxDomainDoubleOk);
-
-    if (unsupportedDomain.isValid() && unsupportedDomain.canConvert<bool>()) {
-        return !unsupportedDomain.toBool();
-    } else if (minDomain.isValid() && minDomain.canConvert<double>() && maxDomain.isValid() && maxDomain.canConvert<double>()) {
-        if (!doubleValueOk || !minDomainDoubleOk || !maxDomainDoubleOk) {
-            QString errorString;
-            QDebug(&errorString) << "Can't compare values:" << value << "minimum:" << minDomain << "maximum:" << maxDomain;
-            qtif_qmlOrCppWarning(this, errorString.trimmed());
-            return false;
-        }
-        return !(doubleValue < minDomainDouble || doubleValue > maxDomainDouble);
-    } else if (minDomain.isValid() && minDomain.canConvert<double>()) {
-        if (!doubleValueOk || !minDomainDoubleOk) {
-            QString errorString;
-            QDebug(&errorString) << "Can't compare values:" << value << minDomain;
-            qtif_qmlOrCppWarning(this, errorString.trimmed());
-            return false;
-        }
-        return doubleValue >= minDomainDouble;
-    } else if (maxDomain.isValid() && maxDomain.canConvert<double>()) {
-        if (!doubleValueOk || !maxDomainDoubleOk) {
-            QString errorString;
-            QDebug(&errorString) << "Can't compare values:" << value << maxDomain;
-            qtif_qmlOrCppWarning(this, errorString.trimmed());
-            return false;
-        }
-        return doubleValue <= maxDomainDouble;
-    } if (domainDomain.isValid() && domainDomain.canConvert<QVariantList>()) {
-        return domainDomain.toList().contains(value);
-    }
-
-    return true;
+    return checkConstraint(compileConstraint(data, zone), value);
 }
 
 /*!
@@ -472,6 +485,219 @@ QVariant QIfSimulationGlobalObject::parseDomainValue(const QVariantMap &data, co
     return qtif_convertFromJSON(domainData);
 }
 
+/*!
+    \qmlmethod bool IfSimulator::checkProperty(string interface, string property, var value, string zone)
+    \since 6.9
+
+    Returns whether \a value meets the constraint of \a property of \a interface in the given
+    \a zone.
+
+    In contrast to checkSettings(), the boundaries are not parsed again for every call, but are
+    read from the simulation data once per interface. The \a interface is searched in the same way
+    as in findData(). If no boundaries are defined for \a property, \c true is returned.
+
+    \sa propertyConstraint()
+*/
+bool QIfSimulationGlobalObject::checkProperty(const QString &interface, const QString &property, const QVariant &value, const QString &zone)
+{
+    const QIfSimulationPropertyConstraints *constraints = propertyConstraints(interface, property);
+    if (!constraints)
+        return true;
+    return checkConstraint(constraints->forZone(zone), value);
+}
+
+/*!
+    \qmlmethod string IfSimulator::propertyConstraint(string interface, string property, string zone)
+    \since 6.9
+
+    Returns the constraint of \a property of \a interface in the given \a zone in a human
+    readable form.
+
+    This is the counterpart of constraint() for the boundaries read from the simulation data.
+
+    \sa checkProperty()
+*/
+QString QIfSimulationGlobalObject::propertyConstraint(const QString &interface, const QString &property, const QString &zone)
+{
+    const QIfSimulationPropertyConstraints *constraints = propertyConstraints(interface, property);
+    if (!constraints)
+        return QString();
+    return constraintString(constraints->forZone(zone));
+}
+
+QString QIfSimulationGlobalObject::interfaceKey(const QString &interface)
+{
+    auto it = m_interfaceKeys.constFind(interface);
+    if (it == m_interfaceKeys.cend()) {
+        const QString key = m_cborData.isNull() ? findDataKey(m_simulationData.toMap(), interface)
+                                                : findDataKey(m_cborInterfaces, interface);
+        it = m_interfaceKeys.insert(interface, key);
+    }
+    return *it;
+}
+
+QVariantMap QIfSimulationGlobalObject::interfaceData(const QString &key)
+{
+    if (m_cborData.isNull())
+        return m_simulationData.toMap().value(key).toMap();
+
+    auto it = m_decodedInterfaces.constFind(key);
+    if (it == m_decodedInterfaces.cend())
+        it = m_decodedInterfaces.insert(key, QCborValue::fromCbor(m_cborInterfaces.value(key)).toVariant().toMap());
+    return *it;
+}
+
+QIfSimulationConstraint QIfSimulationGlobalObject::compileConstraint(const QVariantMap &data, const QString &zone, bool zoneFallback)
+{
+    auto parse = [&](const QString &domain) {
+        // Zones without zone specific values use the whole domain value, see parseDomainValue()
+        if (zoneFallback)
+            return data.contains(domain) ? qtif_convertFromJSON(data.value(domain)) : QVariant();
+        return parseDomainValue(data, domain, zone);
+    };
+
+    QIfSimulationConstraint c;
+
+    const QVariant unsupportedDomain = parse(unsupportedLiteral);
+    QVariant minDomain = parse(minLiteral);
+    QVariant maxDomain = parse(maxLiteral);
+    const QVariant rangeDomain = parse(rangeLiteral);
+    if (rangeDomain.isValid()) {
+        const QVariantList range = rangeDomain.toList();
+        c.rangeSize = range.count();
+        if (range.count() == 2) {
+            minDomain = range.at(0);
+            maxDomain = range.at(1);
+        }
+    }
+    const QVariant domainDomain = parse(domainLiteral);
+
+    c.unsupportedValid = unsupportedDomain.isValid() && unsupportedDomain.canConvert<bool>();
+    c.unsupported = c.unsupportedValid && unsupportedDomain.toBool();
+    c.minimum = minDomain;
+    c.minimumValid = minDomain.isValid() && minDomain.canConvert<double>();
+    c.minimumValue = minDomain.toDouble(&c.minimumOk);
+    c.maximum = maxDomain;
+    c.maximumValid = maxDomain.isValid() && maxDomain.canConvert<double>();
+    c.maximumValue = maxDomain.toDouble(&c.maximumOk);
+    c.domainValid = domainDomain.isValid() && domainDomain.canConvert<QVariantList>();
+    if (c.domainValid)
+        c.domain = domainDomain.toList();
+
+    if (unsupportedDomain.isValid())
+        c.constraint = unsupportedLiteral;
+    else if (minDomain.isValid() && maxDomain.isValid())
+        c.constraint = u"["_s + minDomain.toString() + u"-"_s + maxDomain.toString() + u"]"_s ;
+    else if (minDomain.isValid())
+        c.constraint = u">= "_s + minDomain.toString();
+    else if (maxDomain.isValid())
+        c.constraint = u"<= "_s + maxDomain.toString();
+    else if (domainDomain.isValid())
+        c.constraint = QString::fromUtf8(QJsonDocument::fromVariant(domainDomain).toJson(QJsonDocument::Compact));
+
+    return c;
+}
+
+QIfSimulationPropertyConstraints QIfSimulationGlobalObject::compilePropertyConstraints(const QVariantMap &data)
+{
+    // Every zone which has specific values in any of the domains gets its own entry
+    QSet<QString> zones;
+    for (const QString &domain : { unsupportedLiteral, minLiteral, maxLiteral, rangeLiteral, domainLiteral }) {
+        const QVariant domainData = data.value(domain);
+        if (domainData.metaType().id() != QMetaType::QVariantMap)
+            continue;
+        const QVariantMap domainMap = domainData.toMap();
+        for (auto it = domainMap.cbegin(); it != domainMap.cend(); ++it) {
+            if (!it.key().isEmpty() && it.key() != u"="_s)
+                zones.insert(it.key());
+        }
+    }
+
+    QIfSimulationPropertyConstraints constraints;
+    constraints.unzoned = compileConstraint(data, QString());
+    constraints.fallback = compileConstraint(data, QString(), true);
+    for (const QString &zone : std::as_const(zones))
+        constraints.zones.insert(zone, compileConstraint(data, zone));
+    return constraints;
+}
+
+const QIfSimulationPropertyConstraints *QIfSimulationGlobalObject::propertyConstraints(const QString &interface, const QString &property)
+{
+    const QString key = interfaceKey(interface);
+    if (key.isNull())
+        return nullptr;
+
+    auto interfaceIt = m_constraints.constFind(key);
+    if (interfaceIt == m_constraints.cend()) {
+        // Resolve the boundaries of all properties of the interface once, to make checking new
+        // values a simple lookup
+        QHash<QString, QIfSimulationPropertyConstraints> properties;
+        const QVariantMap propertyMap = interfaceData(key);
+        for (auto p = propertyMap.cbegin(); p != propertyMap.cend(); ++p) {
+            if (p.value().metaType().id() == QMetaType::QVariantMap)
+                properties.insert(p.key(), compilePropertyConstraints(p.value().toMap()));
+        }
+        interfaceIt = m_constraints.insert(key, properties);
+    }
+
+    auto it = interfaceIt->constFind(property);
+    if (it == interfaceIt->cend())
+        return nullptr;
+    return &(*it);
+}
+
+bool QIfSimulationGlobalObject::checkConstraint(const QIfSimulationConstraint &c, const QVariant &value)
+{
+    if (c.rangeSize == 0)
+        return true;
+    if (c.rangeSize != -1 && c.rangeSize != 2) {
+        qtif_qmlOrCppWarning(this, "Domain 'range' needs to be list of exactly two values");
+        return false;
+    }
+
+    bool doubleValueOk = false;
+    double doubleValue = value.toDouble(&doubleValueOk);
+
+    if (c.unsupportedValid) {
+        return !c.unsupported;
+    } else if (c.minimumValid && c.maximumValid) {
+        if (!doubleValueOk || !c.minimumOk || !c.maximumOk) {
+            QString errorString;
+            QDebug(&errorString) << "Can't compare values:" << value << "minimum:" << c.minimum << "maximum:" << c.maximum;
+            qtif_qmlOrCppWarning(this, errorString.trimmed());
+            return false;
+        }
+        return !(doubleValue < c.minimumValue || doubleValue > c.maximumValue);
+    } else if (c.minimumValid) {
+        if (!doubleValueOk || !c.minimumOk) {
+            QString errorString;
+            QDebug(&errorString) << "Can't compare values:" << value << c.minimum;
+            qtif_qmlOrCppWarning(this, errorString.trimmed());
+            return false;
+        }
+        return doubleValue >= c.minimumValue;
+    } else if (c.maximumValid) {
+        if (!doubleValueOk || !c.maximumOk) {
+            QString errorString;
+            QDebug(&errorString) << "Can't compare values:" << value << c.maximum;
+            qtif_qmlOrCppWarning(this, errorString.trimmed());
+            return false;
+        }
+        return doubleValue <= c.maximumValue;
+    } if (c.domainValid) {
+        return c.domain.contains(value);
+    }
+
+    return true;
+}
+
+QString QIfSimulationGlobalObject::constraintString(const QIfSimulationConstraint &c)
+{
+    if (c.rangeSize != -1 && c.rangeSize != 2)
+        qtif_qmlOrCppWarning(this, "Domain 'range' needs to be list of exactly two values");
+    return c.constraint;
+}
+
 QGenericArgument QIfSimulationGlobalObject::createArgument(const QVariant &variant)
 {
     return QGenericArgument(variant.typeName(), variant.data());
@@ -21,6 +21,9 @@
 #include <QIfPagingModelInterface>
 
 #include <QtCore/QObject>
+#include <QtCore/QCborError>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
 #include <QtCore/QVariantMap>
 #include <QtCore/QMetaType>
 #include <QtCore/QMetaObject>
@@ -31,8 +34,46 @@
 #include <QDebug>
 #include <private/qglobal_p.h>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
+// The boundaries of a property in a single zone, resolved from the simulation data
+struct QIfSimulationConstraint
+{
+    QVariant minimum;
+    QVariant maximum;
+    double minimumValue = 0;
+    double maximumValue = 0;
+    bool minimumValid = false;
+    bool minimumOk = false;
+    bool maximumValid = false;
+    bool maximumOk = false;
+    bool unsupportedValid = false;
+    bool unsupported = false;
+    bool domainValid = false;
+    QVariantList domain;
+    // Number of entries in the range domain or -1 if no range is set
+    qsizetype rangeSize = -1;
+    QString constraint;
+};
+
+struct QIfSimulationPropertyConstraints
+{
+    const QIfSimulationConstraint &forZone(const QString &zone) const
+    {
+        if (zone.isEmpty())
+            return unzoned;
+        auto it = zones.constFind(zone);
+        return it != zones.cend() ? *it : fallback;
+    }
+
+    QIfSimulationConstraint unzoned;
+    // Used for all zones without zone specific values
+    QIfSimulationConstraint fallback;
+    QHash<QString, QIfSimulationConstraint> zones;
+};
+
 class Q_QTINTERFACEFRAMEWORK_EXPORT QIfSimulationGlobalObject : public QObject
 {
     Q_OBJECT
@@ -43,17 +84,40 @@ public:
 
     QVariant simulationData() const;
     void setSimulationData(const QVariant &simulationData);
+    QCborError setCborSimulationData(const QByteArray &data, std::unique_ptr<QFile> mappedFile = {});
 
     Q_INVOKABLE QVariantMap findData(const QVariantMap &data, const QString &interface);
+    Q_INVOKABLE QVariantMap findInterfaceData(const QString &interface);
     Q_INVOKABLE void initializeDefault(const QVariantMap &data, QObject *object);
     Q_INVOKABLE QVariant defaultValue(const QVariantMap &data, const QString &zone = QString());
     Q_INVOKABLE QString constraint(const QVariantMap &data, const QString &zone = QString());
     Q_INVOKABLE bool checkSettings(const QVariantMap &data, const QVariant &value, const QString &zone = QString());
     Q_INVOKABLE QVariant parseDomainValue(const QVariantMap &data, const QString &domain, const QString &zone = QString());
 
+    Q_INVOKABLE bool checkProperty(const QString &interface, const QString &property, const QVariant &value, const QString &zone = QString());
+    Q_INVOKABLE QString propertyConstraint(const QString &interface, const QString &property, const QString &zone = QString());
+
 private:
+    QString interfaceKey(const QString &interface);
+    QVariantMap interfaceData(const QString &key);
+    QIfSimulationConstraint compileConstraint(const QVariantMap &data, const QString &zone, bool zoneFallback = false);
+    QIfSimulationPropertyConstraints compilePropertyConstraints(const QVariantMap &data);
+    const QIfSimulationPropertyConstraints *propertyConstraints(const QString &interface, const QString &property);
+    bool checkConstraint(const QIfSimulationConstraint &constraint, const QVariant &value);
+    QString constraintString(const QIfSimulationConstraint &constraint);
+
     QGenericArgument createArgument(const QVariant &variant);
-    QVariant m_simulationData;
+    mutable QVariant m_simulationData;
+    // The undecoded CBOR simulation data, which might point into m_cborFile's memory mapping
+    QByteArray m_cborData;
+    std::unique_ptr<QFile> m_cborFile;
+    // The encoded data of every interface within m_cborData
+    QHash<QString, QByteArray> m_cborInterfaces;
+    QHash<QString, QVariantMap> m_decodedInterfaces;
+    // The constraints of all properties, compiled once per interface on first use
+    QHash<QString, QHash<QString, QIfSimulationPropertyConstraints>> m_constraints;
+    // Maps the interface names used for lookups to the key in the simulation data
+    QHash<QString, QString> m_interfaceKeys;
 };
 
 QT_END_NAMESPACE
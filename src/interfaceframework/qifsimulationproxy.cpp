@@ -8,6 +8,7 @@
 
 #include <QDebug>
 #include <QQmlInfo>
+#include <QReadWriteLock>
 
 #include <private/qmetaobjectbuilder_p.h>
 
@@ -208,34 +209,79 @@ QMetaObject QIfSimulationProxyBase::buildObject(const QMetaObject *metaObject, Q
     return *builder.toMetaObject();
 }
 
-bool QIfSimulationProxyBase::callQmlMethod(const char *function, QGenericReturnArgument ret, QGenericArgument val0, QGenericArgument val1, QGenericArgument val2, QGenericArgument val3, QGenericArgument val4, QGenericArgument val5, QGenericArgument val6, QGenericArgument val7, QGenericArgument val8, QGenericArgument val9)
+namespace {
+
+struct QmlMethodCache
 {
-    if (m_noSimulationEngine)
-        return false;
+    QReadWriteLock lock;
+    // Resolved method index of every called signature, or -1 if not implemented in QML
+    QHash<const QMetaObject *, QHash<QByteArray, int>> indexes;
+};
 
-    bool functionExecuted = false;
-    const QMetaObject *mo = metaObject();
+Q_GLOBAL_STATIC(QmlMethodCache, qmlMethodCache)
+
+// Returns the index of the method matching signature, if it is declared in QML. Otherwise -1 is
+// returned. All proxies of the same QML type share the metaobject, the lookup is done only once
+// per metaobject and signature.
+int qmlMethodIndex(const QMetaObject *mo, const QByteArray &signature)
+{
+    QmlMethodCache *cache = qmlMethodCache();
+    {
+        QReadLocker locker(&cache->lock);
+        const auto moIt = cache->indexes.constFind(mo);
+        if (moIt != cache->indexes.cend()) {
+            const auto it = moIt->constFind(signature);
+            if (it != moIt->cend())
+                return *it;
+        }
+    }
 
     // Only invoke the functions declared in QML.
     // Once a function/property is added to a type a new MetaObject gets created which contains
     // _QML in the name.
     // _QML_ For a C++ type registered to QML
     // _QMLTYPE_ For a QML type derived from a C++ type
+    int qmlMethodOffset = mo->methodCount();
+    for (const QMetaObject *qmlMo = mo; qmlMo && QByteArrayView(qmlMo->className()).contains("_QML"); qmlMo = qmlMo->superClass())
+        qmlMethodOffset = qmlMo->methodOffset();
+
+    int index = mo->indexOfMethod(QMetaObject::normalizedSignature(signature.constData()).constData());
+    if (index < qmlMethodOffset)
+        index = -1;
+
+    qCDebug(qLcIfSimulationEngine) << "Resolved QML method" << signature << "to index" << index;
+    QWriteLocker locker(&cache->lock);
+    cache->indexes[mo].insert(signature, index);
+    return index;
+}
 
-    // qDebug() << "METAOBJECT" << mo->className();
+} // namespace
 
-    while (mo && !functionExecuted && QString::fromLatin1(mo->className()).contains(QLatin1String("_QML"))) {
-        for (int i=mo->methodOffset(); i<mo->methodCount(); i++) {
-            //qDebug() << "CHECKING FOR: " << function << mo->method(i).name();
-            if (mo->method(i).name() != function)
-                continue;
-            //qDebug() << "EXECUTING";
-            functionExecuted = QMetaObject::invokeMethod(this, function, ret, val0, val1, val2, val3, val4, val5, val6, val7, val8, val9);
+bool QIfSimulationProxyBase::callQmlMethod(const char *function, QGenericReturnArgument ret, QGenericArgument val0, QGenericArgument val1, QGenericArgument val2, QGenericArgument val3, QGenericArgument val4, QGenericArgument val5, QGenericArgument val6, QGenericArgument val7, QGenericArgument val8, QGenericArgument val9)
+{
+    if (m_noSimulationEngine)
+        return false;
+
+    const QGenericArgument args[] = { val0, val1, val2, val3, val4, val5, val6, val7, val8, val9 };
+
+    // The signature is only used as the cache key and gets normalized once it is resolved
+    QByteArray signature(function);
+    signature += '(';
+    for (const QGenericArgument &arg : args) {
+        if (!arg.name())
             break;
-        }
-        mo = mo->superClass();
+        if (signature.back() != '(')
+            signature += ',';
+        signature += arg.name();
     }
-    return functionExecuted;
+    signature += ')';
+
+    const QMetaObject *mo = metaObject();
+    const int index = qmlMethodIndex(mo, signature);
+    if (index < 0)
+        return false;
+
+    return mo->method(index).invoke(this, ret, val0, val1, val2, val3, val4, val5, val6, val7, val8, val9);
 }
 
 void QIfSimulationProxyBase::setup(QIfSimulationEngine *engine)
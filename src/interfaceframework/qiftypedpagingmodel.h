@@ -0,0 +1,31 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIFTYPEDPAGINGMODEL_H
+#define QIFTYPEDPAGINGMODEL_H
+
+#include <QtInterfaceFramework/QIfPagingModel>
+#include <QtInterfaceFramework/QIfStandardItem>
+
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+
+template <typename T> class QIfTypedPagingModel : public QIfPagingModel
+{
+    static_assert(std::is_base_of_v<QIfStandardItem, T>, "The item type needs to be derived from QIfStandardItem");
+
+public:
+    explicit QIfTypedPagingModel(QObject *parent = nullptr)
+        : QIfPagingModel(parent)
+    {
+        qRegisterMetaType<T>();
+        setItemMetaType(QMetaType::fromType<T>(), [](const void *item) -> const QIfStandardItem * {
+            return static_cast<const T *>(item);
+        });
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // QIFTYPEDPAGINGMODEL_H
@@ -0,0 +1,645 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qifqueryevaluator_p.h"
+
+#include <QtCore/QMetaProperty>
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+
+using namespace Qt::StringLiterals;
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+    // Smaller lists are faster to process in the calling thread
+    constexpr qsizetype parallelThreshold = 10000;
+
+    bool isNumber(QMetaType type)
+    {
+        switch (type.id()) {
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Long:
+        case QMetaType::ULong:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+        case QMetaType::Short:
+        case QMetaType::UShort:
+        case QMetaType::Float:
+        case QMetaType::Double:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    int orderingToInt(QPartialOrdering ordering)
+    {
+        if (ordering == QPartialOrdering::Less)
+            return -1;
+        if (ordering == QPartialOrdering::Greater)
+            return 1;
+        // Unordered values are treated as equal to keep the sort stable
+        return 0;
+    }
+
+    int taskCount(qsizetype count, QIfQueryEvaluator::ExecutionPolicy policy)
+    {
+        if (policy != QIfQueryEvaluator::Parallel || count < parallelThreshold)
+            return 1;
+        return int(qBound(qsizetype(1), qsizetype(QThread::idealThreadCount()), count / (parallelThreshold / 2)));
+    }
+
+    /*
+        Runs the \a task for all indexes up to \a count using the global thread pool.
+
+        The calling thread takes part in the work and runs all tasks which didn't start yet itself,
+        which makes sure this also finishes when called from a busy thread pool.
+    */
+    void runTasks(int count, const std::function<void(int index)> &task)
+    {
+        if (count <= 1) {
+            if (count == 1)
+                task(0);
+            return;
+        }
+
+        QThreadPool *pool = QThreadPool::globalInstance();
+        QSemaphore finished;
+        std::vector<std::unique_ptr<QRunnable>> runnables;
+        runnables.reserve(count - 1);
+        for (int i = 1; i < count; i++) {
+            runnables.emplace_back(QRunnable::create([&task, &finished, i]() {
+                task(i);
+                finished.release();
+            }));
+            runnables.back()->setAutoDelete(false);
+            pool->start(runnables.back().get());
+        }
+
+        task(0);
+        for (const auto &runnable : runnables) {
+            if (pool->tryTake(runnable.get()))
+                runnable->run();
+        }
+        finished.acquire(count - 1);
+    }
+}
+
+class QIfQueryEvaluatorPrivate : public QSharedData
+{
+public:
+    struct Node {
+        enum Kind {
+            Filter,
+            And,
+            Or
+        };
+
+        Kind kind = Filter;
+        bool negated = false;
+        QList<int> children;
+
+        QMetaProperty property;
+        QIfFilterTerm::Operator operatorType = QIfFilterTerm::Equals;
+        QVariant value;
+        QString stringValue;
+        // The value of the property needs to be converted to the type of the filter value
+        bool convertProperty = false;
+    };
+
+    struct Order {
+        QMetaProperty property;
+        bool ascending = true;
+    };
+
+    struct IndexRange {
+        QList<QIfQueryIndexPrivate::Entry>::const_iterator begin;
+        QList<QIfQueryIndexPrivate::Entry>::const_iterator end;
+    };
+
+    int compile(const QIfAbstractQueryTerm *term);
+    int compileFilter(const QIfFilterTerm *term);
+    bool resolveProperty(const QString &name, QMetaProperty *property);
+    bool matches(int node, const void *gadget) const;
+    bool matchesFilter(const Node &node, const void *gadget) const;
+    const void *gadgetFromVariant(const QVariant &item) const;
+    bool indexRange(const QIfQueryIndexPrivate *index, int node, IndexRange *range) const;
+
+    const QMetaObject *m_metaObject = nullptr;
+    QList<Node> m_nodes;
+    QList<Order> m_orders;
+    int m_root = -1;
+    QString m_error;
+};
+
+int QIfQueryEvaluatorPrivate::compile(const QIfAbstractQueryTerm *term)
+{
+    switch (term->type()) {
+    case QIfAbstractQueryTerm::FilterTerm:
+        return compileFilter(static_cast<const QIfFilterTerm *>(term));
+    case QIfAbstractQueryTerm::ScopeTerm: {
+        // Scopes only group terms, the negation is applied to the compiled term directly
+        const auto scope = static_cast<const QIfScopeTerm *>(term);
+        const int index = compile(scope->term());
+        if (index >= 0 && scope->isNegated())
+            m_nodes[index].negated = !m_nodes[index].negated;
+        return index;
+    }
+    case QIfAbstractQueryTerm::ConjunctionTerm: {
+        const auto conjunction = static_cast<const QIfConjunctionTerm *>(term);
+        Node node;
+        node.kind = conjunction->conjunction() == QIfConjunctionTerm::And ? Node::And : Node::Or;
+        const auto terms = conjunction->terms();
+        for (const QIfAbstractQueryTerm *child : terms) {
+            const int index = compile(child);
+            if (index < 0)
+                return -1;
+            node.children.append(index);
+        }
+        m_nodes.append(node);
+        return int(m_nodes.count() - 1);
+    }
+    }
+
+    m_error = u"Unknown query term type: %1"_s.arg(int(term->type()));
+    return -1;
+}
+
+int QIfQueryEvaluatorPrivate::compileFilter(const QIfFilterTerm *term)
+{
+    Node node;
+    node.negated = term->isNegated();
+    node.operatorType = term->operatorType();
+    node.value = term->value();
+    if (!resolveProperty(term->propertyName(), &node.property))
+        return -1;
+
+    const QMetaType propertyType = node.property.metaType();
+    const QMetaType valueType = node.value.metaType();
+
+    // Decide once how the values are compared, instead of converting them for every item
+    if (node.operatorType == QIfFilterTerm::EqualsCaseInsensitive) {
+        node.stringValue = node.value.toString();
+    } else if (propertyType != valueType && !(isNumber(propertyType) && isNumber(valueType))) {
+        // Numbers are compared by their value. Everything else is compared using the type of the
+        // property, if the filter value can be converted to it.
+        QVariant converted = node.value;
+        const bool convertible = propertyType.isValid() && propertyType != QMetaType::fromType<QVariant>();
+        if (!isNumber(valueType) && convertible && converted.convert(propertyType))
+            node.value = converted;
+        else
+            node.convertProperty = true;
+    }
+
+    m_nodes.append(node);
+    return int(m_nodes.count() - 1);
+}
+
+bool QIfQueryEvaluatorPrivate::resolveProperty(const QString &name, QMetaProperty *property)
+{
+    const int index = m_metaObject->indexOfProperty(name.toUtf8().constData());
+    if (index < 0) {
+        m_error = u"%1 doesn't have a property called %2"_s.arg(QLatin1String(m_metaObject->className()), name);
+        return false;
+    }
+
+    *property = m_metaObject->property(index);
+    return true;
+}
+
+bool QIfQueryEvaluatorPrivate::matches(int index, const void *gadget) const
+{
+    const Node &node = m_nodes.at(index);
+    bool result = false;
+
+    switch (node.kind) {
+    case Node::Filter:
+        result = matchesFilter(node, gadget);
+        break;
+    case Node::And:
+        result = std::all_of(node.children.cbegin(), node.children.cend(), [this, gadget](int child) {
+            return matches(child, gadget);
+        });
+        break;
+    case Node::Or:
+        result = std::any_of(node.children.cbegin(), node.children.cend(), [this, gadget](int child) {
+            return matches(child, gadget);
+        });
+        break;
+    }
+
+    return result != node.negated;
+}
+
+bool QIfQueryEvaluatorPrivate::matchesFilter(const Node &node, const void *gadget) const
+{
+    QVariant value = node.property.readOnGadget(gadget);
+
+    if (node.operatorType == QIfFilterTerm::EqualsCaseInsensitive)
+        return value.toString().compare(node.stringValue, Qt::CaseInsensitive) == 0;
+
+    if (node.convertProperty && !value.convert(node.value.metaType()))
+        return false;
+
+    switch (node.operatorType) {
+    case QIfFilterTerm::Equals:
+        return value == node.value;
+    case QIfFilterTerm::Unequals:
+        return value != node.value;
+    case QIfFilterTerm::GreaterThan:
+        return QVariant::compare(value, node.value) == QPartialOrdering::Greater;
+    case QIfFilterTerm::GreaterEquals: {
+        const QPartialOrdering ordering = QVariant::compare(value, node.value);
+        return ordering == QPartialOrdering::Greater || ordering == QPartialOrdering::Equivalent;
+    }
+    case QIfFilterTerm::LowerThan:
+        return QVariant::compare(value, node.value) == QPartialOrdering::Less;
+    case QIfFilterTerm::LowerEquals: {
+        const QPartialOrdering ordering = QVariant::compare(value, node.value);
+        return ordering == QPartialOrdering::Less || ordering == QPartialOrdering::Equivalent;
+    }
+    case QIfFilterTerm::EqualsCaseInsensitive:
+        break;
+    }
+
+    return false;
+}
+
+const void *QIfQueryEvaluatorPrivate::gadgetFromVariant(const QVariant &item) const
+{
+    // The properties were resolved for m_metaObject, which are also valid for derived gadgets
+    return qtif_private::gadgetPointer(item, m_metaObject);
+}
+
+/*
+    Looks up the entries of \a index which can match the filter \a node and stores them in
+    \a range. Returns \c false if the filter can't be answered by the index.
+*/
+bool QIfQueryEvaluatorPrivate::indexRange(const QIfQueryIndexPrivate *index, int nodeIndex, IndexRange *range) const
+{
+    const Node &node = m_nodes.at(nodeIndex);
+    if (node.kind != Node::Filter || node.negated || node.convertProperty)
+        return false;
+
+    const QIfQueryIndexPrivate::PropertyIndex *propertyIndex = index->findIndex(node.property);
+    if (!propertyIndex)
+        return false;
+
+    const QList<QIfQueryIndexPrivate::Entry> &entries = propertyIndex->entries;
+    const auto lowerBound = [&entries, &node]() {
+        return std::partition_point(entries.cbegin(), entries.cend(), [&node](const QIfQueryIndexPrivate::Entry &entry) {
+            return QIfQueryIndexPrivate::compareValues(entry.value, node.value) < 0;
+        });
+    };
+    const auto upperBound = [&entries, &node]() {
+        return std::partition_point(entries.cbegin(), entries.cend(), [&node](const QIfQueryIndexPrivate::Entry &entry) {
+            return QIfQueryIndexPrivate::compareValues(entry.value, node.value) <= 0;
+        });
+    };
+
+    switch (node.operatorType) {
+    case QIfFilterTerm::Equals:
+        *range = { lowerBound(), upperBound() };
+        return true;
+    case QIfFilterTerm::GreaterThan:
+        *range = { upperBound(), entries.cend() };
+        return true;
+    case QIfFilterTerm::GreaterEquals:
+        *range = { lowerBound(), entries.cend() };
+        return true;
+    case QIfFilterTerm::LowerThan:
+        *range = { entries.cbegin(), lowerBound() };
+        return true;
+    case QIfFilterTerm::LowerEquals:
+        *range = { entries.cbegin(), upperBound() };
+        return true;
+    case QIfFilterTerm::Unequals:
+    case QIfFilterTerm::EqualsCaseInsensitive:
+        break;
+    }
+
+    return false;
+}
+
+/*!
+    \class QIfQueryEvaluator
+    \inmodule QtInterfaceFramework
+    \internal
+
+    \brief Evaluates a query term tree and order terms on lists of gadgets.
+
+    The evaluator compiles the terms created by the QIfQueryParser once for the given gadget type:
+    all properties are resolved and the filter values are prepared for comparison. It can be used
+    by backends which keep their data in memory, instead of implementing the evaluation of the
+    terms passed to QIfFilterAndBrowseModelInterface::setupFilter() themselves.
+
+    The items can be passed as gadgets or as QVariants holding the gadgets. Large lists can be
+    filtered and sorted using several threads by passing the Parallel ExecutionPolicy. This is
+    only safe if the items are not modified meanwhile.
+
+    Backends which run many queries on the same list can keep a QIfQueryIndex for it. Equality
+    and range filters on indexed properties and the first order term are then answered by
+    looking up the index, instead of checking and sorting every item.
+*/
+
+QIfQueryEvaluator::QIfQueryEvaluator()
+    : d(new QIfQueryEvaluatorPrivate)
+{
+}
+
+/*!
+    Compiles the filter \a term and the \a orderTerms for gadgets of the type \a metaObject.
+
+    The \a term can be \c nullptr if no filtering is needed. If a term refers to a property which
+    doesn't exist, the evaluator is invalid and errorString() returns the reason.
+*/
+QIfQueryEvaluator::QIfQueryEvaluator(const QMetaObject *metaObject, const QIfAbstractQueryTerm *term, const QList<QIfOrderTerm> &orderTerms)
+    : d(new QIfQueryEvaluatorPrivate)
+{
+    Q_ASSERT(metaObject);
+    d->m_metaObject = metaObject;
+
+    if (term) {
+        d->m_root = d->compile(term);
+        if (d->m_root < 0)
+            return;
+    }
+
+    for (const QIfOrderTerm &orderTerm : orderTerms) {
+        QIfQueryEvaluatorPrivate::Order order;
+        if (!d->resolveProperty(orderTerm.propertyName(), &order.property))
+            return;
+        order.ascending = orderTerm.isAscending();
+        d->m_orders.append(order);
+    }
+}
+
+QIfQueryEvaluator::QIfQueryEvaluator(const QIfQueryEvaluator &other) = default;
+
+QIfQueryEvaluator &QIfQueryEvaluator::operator=(const QIfQueryEvaluator &other) = default;
+
+QIfQueryEvaluator::~QIfQueryEvaluator() = default;
+
+bool QIfQueryEvaluator::isValid() const
+{
+    return d->m_metaObject && d->m_error.isEmpty();
+}
+
+QString QIfQueryEvaluator::errorString() const
+{
+    return d->m_error;
+}
+
+const QMetaObject *QIfQueryEvaluator::metaObject() const
+{
+    return d->m_metaObject;
+}
+
+bool QIfQueryEvaluator::hasFilter() const
+{
+    return isValid() && d->m_root >= 0;
+}
+
+bool QIfQueryEvaluator::hasOrder() const
+{
+    return isValid() && !d->m_orders.isEmpty();
+}
+
+/*!
+    Returns \c true if the \a gadget matches the filter. The \a gadget needs to be of the type the
+    evaluator was created for, or derived from it.
+*/
+bool QIfQueryEvaluator::matchesGadget(const void *gadget) const
+{
+    if (!hasFilter())
+        return isValid();
+    return d->matches(d->m_root, gadget);
+}
+
+/*!
+    Compares the gadgets \a left and \a right using the order terms.
+
+    Returns a negative value if \a left needs to be sorted before \a right, a positive value if it
+    needs to be sorted after it and \c 0 if both are equivalent.
+*/
+int QIfQueryEvaluator::compareGadgets(const void *left, const void *right) const
+{
+    if (!isValid())
+        return 0;
+
+    for (const QIfQueryEvaluatorPrivate::Order &order : std::as_const(d->m_orders)) {
+        const int result = orderingToInt(QVariant::compare(order.property.readOnGadget(left),
+                                                           order.property.readOnGadget(right)));
+        if (result != 0)
+            return order.ascending ? result : -result;
+    }
+    return 0;
+}
+
+bool QIfQueryEvaluator::matches(const QVariant &item) const
+{
+    const void *gadget = d->gadgetFromVariant(item);
+    return gadget && matchesGadget(gadget);
+}
+
+int QIfQueryEvaluator::compare(const QVariant &left, const QVariant &right) const
+{
+    const void *leftGadget = d->gadgetFromVariant(left);
+    const void *rightGadget = d->gadgetFromVariant(right);
+    // Items of an unexpected type are sorted to the end
+    if (!leftGadget || !rightGadget)
+        return int(!leftGadget) - int(!rightGadget);
+    return compareGadgets(leftGadget, rightGadget);
+}
+
+/*!
+    Returns the rows of all items matching the filter, sorted by the order terms.
+
+    The rows are looked up in \a index, which needs to be up to date with the list of items. The
+    gadget of a row is returned by \a gadgetAt, which returns \c nullptr for items which are not
+    gadgets of the expected type. The result is the same as for apply(), but only the items which
+    can match the indexed filters are checked.
+*/
+QList<qsizetype> QIfQueryEvaluator::indexedRows(const QIfQueryIndex &index, const std::function<const void *(qsizetype row)> &gadgetAt) const
+{
+    if (!isValid())
+        return {};
+
+    const QIfQueryIndexPrivate *indexData = index.d.constData();
+    const qsizetype count = indexData->m_count;
+
+    // The filter terms combined by a top level "and" all need to match, the smallest range of
+    // the indexed ones contains all matching items
+    QIfQueryEvaluatorPrivate::IndexRange narrowest;
+    bool narrowed = false;
+    const auto considerNode = [this, indexData, &narrowest, &narrowed](int node) {
+        QIfQueryEvaluatorPrivate::IndexRange range;
+        if (!d->indexRange(indexData, node, &range))
+            return;
+        if (!narrowed || range.end - range.begin < narrowest.end - narrowest.begin) {
+            narrowest = range;
+            narrowed = true;
+        }
+    };
+    if (d->m_root >= 0) {
+        const QIfQueryEvaluatorPrivate::Node &root = d->m_nodes.at(d->m_root);
+        if (root.kind == QIfQueryEvaluatorPrivate::Node::And && !root.negated) {
+            for (int child : root.children)
+                considerNode(child);
+        } else {
+            considerNode(d->m_root);
+        }
+    }
+
+    QList<qsizetype> candidates;
+    if (narrowed) {
+        candidates.reserve(narrowest.end - narrowest.begin);
+        for (auto it = narrowest.begin; it != narrowest.end; ++it)
+            candidates.append(it->row);
+        std::sort(candidates.begin(), candidates.end());
+    }
+
+    // Rows without a gadget of the expected type never match a filter. Without a filter they are
+    // kept and sorted to the end, the same way as by apply() without an index.
+    const auto lessThan = [this, &gadgetAt](qsizetype left, qsizetype right) {
+        const void *leftGadget = gadgetAt(left);
+        const void *rightGadget = gadgetAt(right);
+        if (!leftGadget || !rightGadget)
+            return leftGadget && !rightGadget;
+        return compareGadgets(leftGadget, rightGadget) < 0;
+    };
+    const auto matchesRow = [this, &gadgetAt](qsizetype row) {
+        const void *gadget = gadgetAt(row);
+        return gadget ? matchesGadget(gadget) : !hasFilter();
+    };
+
+    const QIfQueryIndexPrivate::PropertyIndex *orderIndex =
+        hasOrder() ? indexData->findIndex(d->m_orders.constFirst().property) : nullptr;
+    // Walking the whole order index only pays off if not just a few items are left
+    if (orderIndex && (!narrowed || candidates.size() > count / 8)) {
+        QList<char> isCandidate(narrowed ? count : 0);
+        for (qsizetype row : std::as_const(candidates))
+            isCandidate[row] = 1;
+
+        const QList<QIfQueryIndexPrivate::Entry> &entries = orderIndex->entries;
+        QList<qsizetype> rows;
+        // Equal values are sorted by their row, which is the order of a stable sort. Only the
+        // remaining order terms need to be applied within such a group.
+        const auto appendGroup = [&](qsizetype begin, qsizetype end) {
+            const qsizetype first = rows.size();
+            for (qsizetype i = begin; i < end; i++) {
+                const qsizetype row = entries.at(i).row;
+                if (narrowed && !isCandidate.at(row))
+                    continue;
+                const void *gadget = gadgetAt(row);
+                if (gadget && matchesGadget(gadget))
+                    rows.append(row);
+            }
+            if (d->m_orders.size() > 1 && rows.size() - first > 1)
+                std::stable_sort(rows.begin() + first, rows.end(), lessThan);
+        };
+
+        if (d->m_orders.constFirst().ascending) {
+            for (qsizetype begin = 0; begin < entries.size();) {
+                qsizetype end = begin + 1;
+                while (end < entries.size() && QIfQueryIndexPrivate::compareValues(entries.at(begin).value, entries.at(end).value) == 0)
+                    end++;
+                appendGroup(begin, end);
+                begin = end;
+            }
+        } else {
+            for (qsizetype end = entries.size(); end > 0;) {
+                qsizetype begin = end - 1;
+                while (begin > 0 && QIfQueryIndexPrivate::compareValues(entries.at(begin - 1).value, entries.at(end - 1).value) == 0)
+                    begin--;
+                appendGroup(begin, end);
+                end = begin;
+            }
+        }
+
+        // The rows which are not part of the index
+        if (!hasFilter()) {
+            for (qsizetype row = 0; row < count; row++) {
+                if (!gadgetAt(row))
+                    rows.append(row);
+            }
+        }
+        return rows;
+    }
+
+    QList<qsizetype> rows;
+    if (narrowed) {
+        rows.reserve(candidates.size());
+        for (qsizetype row : std::as_const(candidates)) {
+            if (matchesRow(row))
+                rows.append(row);
+        }
+    } else {
+        for (qsizetype row = 0; row < count; row++) {
+            if (matchesRow(row))
+                rows.append(row);
+        }
+    }
+
+    if (hasOrder())
+        std::stable_sort(rows.begin(), rows.end(), lessThan);
+    return rows;
+}
+
+/*!
+    Calls \a function for consecutive ranges of all indexes up to \a count.
+
+    If \a policy is Parallel and the list is big enough, the ranges are processed in parallel using
+    the global QThreadPool.
+*/
+void QIfQueryEvaluator::forEachBlock(qsizetype count, ExecutionPolicy policy, const std::function<void(qsizetype begin, qsizetype end)> &function)
+{
+    const int tasks = taskCount(count, policy);
+    const qsizetype blockSize = (count + tasks - 1) / qMax(tasks, 1);
+    runTasks(tasks, [&function, blockSize, count](int index) {
+        const qsizetype begin = index * blockSize;
+        function(begin, qMin(begin + blockSize, count));
+    });
+}
+
+/*!
+    Sorts all indexes up to \a count, by calling \a sortFunction for consecutive ranges and merging
+    the sorted ranges using \a mergeFunction.
+
+    If \a policy is Parallel and the list is big enough, the ranges are sorted and merged in parallel
+    using the global QThreadPool.
+*/
+void QIfQueryEvaluator::sortBlocks(qsizetype count, ExecutionPolicy policy,
+                                   const std::function<void(qsizetype begin, qsizetype end)> &sortFunction,
+                                   const std::function<void(qsizetype begin, qsizetype middle, qsizetype end)> &mergeFunction)
+{
+    const int tasks = taskCount(count, policy);
+    if (tasks <= 1) {
+        sortFunction(0, count);
+        return;
+    }
+
+    const qsizetype blockSize = (count + tasks - 1) / tasks;
+    runTasks(tasks, [&sortFunction, blockSize, count](int index) {
+        const qsizetype begin = index * blockSize;
+        sortFunction(begin, qMin(begin + blockSize, count));
+    });
+
+    // Merge neighbouring blocks until only one is left, every pass halves the number of blocks
+    for (qsizetype width = blockSize; width < count; width *= 2) {
+        const int merges = int((count + 2 * width - 1) / (2 * width));
+        runTasks(merges, [&mergeFunction, width, count](int index) {
+            const qsizetype begin = index * 2 * width;
+            const qsizetype middle = qMin(begin + width, count);
+            const qsizetype end = qMin(begin + 2 * width, count);
+            if (middle < end)
+                mergeFunction(begin, middle, end);
+        });
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,164 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIFQUERYEVALUATOR_P_H
+#define QIFQUERYEVALUATOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtInterfaceFramework/qifqueryterm.h>
+#include <QtInterfaceFramework/private/qifqueryindex_p.h>
+
+#include <QtCore/QList>
+#include <QtCore/QMetaObject>
+#include <QtCore/QSharedDataPointer>
+#include <QtCore/QVariant>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QIfQueryEvaluatorPrivate;
+
+class Q_QTINTERFACEFRAMEWORK_EXPORT QIfQueryEvaluator
+{
+public:
+    enum ExecutionPolicy {
+        Sequential,
+        Parallel
+    };
+
+    QIfQueryEvaluator();
+    QIfQueryEvaluator(const QMetaObject *metaObject, const QIfAbstractQueryTerm *term,
+                      const QList<QIfOrderTerm> &orderTerms = {});
+    QIfQueryEvaluator(const QIfQueryEvaluator &other);
+    QIfQueryEvaluator &operator=(const QIfQueryEvaluator &other);
+    ~QIfQueryEvaluator();
+
+    bool isValid() const;
+    QString errorString() const;
+    const QMetaObject *metaObject() const;
+    bool hasFilter() const;
+    bool hasOrder() const;
+
+    bool matchesGadget(const void *gadget) const;
+    int compareGadgets(const void *left, const void *right) const;
+
+    bool matches(const QVariant &item) const;
+    int compare(const QVariant &left, const QVariant &right) const;
+
+    template <typename T>
+    bool matches(const T &item) const
+    {
+        checkType<T>();
+        return matchesGadget(std::addressof(item));
+    }
+
+    template <typename T>
+    int compare(const T &left, const T &right) const
+    {
+        checkType<T>();
+        return compareGadgets(std::addressof(left), std::addressof(right));
+    }
+
+    template <typename T>
+    QList<T> filtered(const QList<T> &list, ExecutionPolicy policy = Sequential) const
+    {
+        // Nothing matches an invalid evaluator
+        if (isValid() && !hasFilter())
+            return list;
+
+        // Every block writes its own range, the result is collected afterwards to keep the order
+        QList<char> matching(list.size());
+        char *matchingData = matching.data();
+        forEachBlock(list.size(), policy, [this, &list, matchingData](qsizetype begin, qsizetype end) {
+            for (qsizetype i = begin; i < end; i++)
+                matchingData[i] = matches(list.at(i));
+        });
+
+        QList<T> result;
+        result.reserve(std::count(matching.cbegin(), matching.cend(), char(1)));
+        for (qsizetype i = 0; i < list.size(); i++) {
+            if (matching.at(i))
+                result.append(list.at(i));
+        }
+        return result;
+    }
+
+    template <typename T>
+    void sort(QList<T> &list, ExecutionPolicy policy = Sequential) const
+    {
+        if (!hasOrder())
+            return;
+
+        // The blocks are sorted and merged from several threads, which must not detach the list
+        T *data = list.data();
+        const auto lessThan = [this](const T &left, const T &right) {
+            return compare(left, right) < 0;
+        };
+        sortBlocks(list.size(), policy, [data, &lessThan](qsizetype begin, qsizetype end) {
+            std::stable_sort(data + begin, data + end, lessThan);
+        }, [data, &lessThan](qsizetype begin, qsizetype middle, qsizetype end) {
+            std::inplace_merge(data + begin, data + middle, data + end, lessThan);
+        });
+    }
+
+    template <typename T>
+    QList<T> apply(const QList<T> &list, ExecutionPolicy policy = Sequential) const
+    {
+        QList<T> result = filtered(list, policy);
+        sort(result, policy);
+        return result;
+    }
+
+    template <typename T>
+    QList<T> apply(const QList<T> &list, const QIfQueryIndex &index) const
+    {
+        Q_ASSERT(index.count() == list.size());
+        const QMetaObject *mo = metaObject();
+        const QList<qsizetype> rows = indexedRows(index, [&list, mo](qsizetype row) {
+            return qtif_private::gadgetPointer(list.at(row), mo);
+        });
+
+        QList<T> result;
+        result.reserve(rows.size());
+        for (qsizetype row : rows)
+            result.append(list.at(row));
+        return result;
+    }
+
+    QList<qsizetype> indexedRows(const QIfQueryIndex &index,
+                                 const std::function<const void *(qsizetype row)> &gadgetAt) const;
+
+    static void forEachBlock(qsizetype count, ExecutionPolicy policy,
+                             const std::function<void(qsizetype begin, qsizetype end)> &function);
+    static void sortBlocks(qsizetype count, ExecutionPolicy policy,
+                           const std::function<void(qsizetype begin, qsizetype end)> &sortFunction,
+                           const std::function<void(qsizetype begin, qsizetype middle, qsizetype end)> &mergeFunction);
+
+private:
+    template <typename T>
+    void checkType() const
+    {
+        static_assert(QtPrivate::IsGadgetHelper<T>::IsGadgetOrDerivedFrom,
+                      "The items need to be gadgets or QVariants");
+        Q_ASSERT(!metaObject() || T::staticMetaObject.inherits(metaObject()));
+    }
+
+    QSharedDataPointer<QIfQueryEvaluatorPrivate> d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QIFQUERYEVALUATOR_P_H
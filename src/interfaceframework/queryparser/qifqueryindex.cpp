@@ -0,0 +1,251 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qifqueryindex_p.h"
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+int QIfQueryIndexPrivate::compareValues(const QVariant &left, const QVariant &right)
+{
+    const QPartialOrdering ordering = QVariant::compare(left, right);
+    if (ordering == QPartialOrdering::Less)
+        return -1;
+    if (ordering == QPartialOrdering::Greater)
+        return 1;
+    // Unordered values are treated as equal, the same way the QIfQueryEvaluator sorts them
+    return 0;
+}
+
+bool QIfQueryIndexPrivate::lessThan(const Entry &left, const Entry &right)
+{
+    const int result = compareValues(left.value, right.value);
+    if (result != 0)
+        return result < 0;
+    return left.row < right.row;
+}
+
+void QIfQueryIndexPrivate::insertEntry(PropertyIndex &index, Entry entry)
+{
+    const auto it = std::upper_bound(index.entries.begin(), index.entries.end(), entry, lessThan);
+    index.entries.insert(it, std::move(entry));
+}
+
+bool QIfQueryIndexPrivate::takeEntry(PropertyIndex &index, qsizetype row, Entry *entry)
+{
+    const auto it = std::find_if(index.entries.begin(), index.entries.end(), [row](const Entry &entry) {
+        return entry.row == row;
+    });
+    // Rows which don't hold a gadget of the indexed type are not part of the index
+    if (it == index.entries.end())
+        return false;
+    if (entry)
+        *entry = std::move(*it);
+    index.entries.erase(it);
+    return true;
+}
+
+const QIfQueryIndexPrivate::PropertyIndex *QIfQueryIndexPrivate::findIndex(const QMetaProperty &property) const
+{
+    for (const PropertyIndex &index : m_indexes) {
+        if (qstrcmp(index.property.name(), property.name()) == 0)
+            return &index;
+    }
+    return nullptr;
+}
+
+/*!
+    \class QIfQueryIndex
+    \inmodule QtInterfaceFramework
+    \internal
+
+    \brief Keeps the rows of an in-memory list of gadgets sorted by the values of some properties.
+
+    Backends which keep their data in a list can create an index for the properties which are
+    used in queries, e.g. the identifiers returned by QIfFilterAndBrowseModelInterface::identifiersFromItem().
+    QIfQueryEvaluator::apply() uses the index to answer equality and range filters and the first
+    order term without scanning and sorting the whole list.
+
+    The index only stores row numbers and needs to be updated whenever the list changes: either
+    by calling reset() or by calling insert(), remove(), move() and update() for every change.
+    Every incremental update takes linear time, which is still a lot cheaper than sorting the list
+    for every query.
+
+    Properties holding a QVariant or a type which can't be ordered are not indexed. If the list
+    holds QVariants, items which are not gadgets of the indexed type are skipped.
+*/
+
+QIfQueryIndex::QIfQueryIndex()
+    : d(new QIfQueryIndexPrivate)
+{
+}
+
+/*!
+    Creates an empty index for the \a properties of gadgets of the type \a metaObject.
+*/
+QIfQueryIndex::QIfQueryIndex(const QMetaObject *metaObject, const QSet<QString> &properties)
+    : d(new QIfQueryIndexPrivate)
+{
+    Q_ASSERT(metaObject);
+    d->m_metaObject = metaObject;
+
+    QStringList names = properties.values();
+    names.sort();
+    for (const QString &name : std::as_const(names)) {
+        const int propertyIndex = metaObject->indexOfProperty(name.toUtf8().constData());
+        if (propertyIndex < 0)
+            continue;
+        const QMetaProperty property = metaObject->property(propertyIndex);
+        const QMetaType type = property.metaType();
+        if (type == QMetaType::fromType<QVariant>() || !type.isOrdered())
+            continue;
+        d->m_indexes.append({ property, {} });
+    }
+}
+
+QIfQueryIndex::QIfQueryIndex(const QIfQueryIndex &other) = default;
+
+QIfQueryIndex &QIfQueryIndex::operator=(const QIfQueryIndex &other) = default;
+
+QIfQueryIndex::~QIfQueryIndex() = default;
+
+const QMetaObject *QIfQueryIndex::metaObject() const
+{
+    return d->m_metaObject;
+}
+
+/*!
+    Returns the names of all properties which are indexed.
+*/
+QStringList QIfQueryIndex::properties() const
+{
+    QStringList names;
+    for (const QIfQueryIndexPrivate::PropertyIndex &index : std::as_const(d->m_indexes))
+        names.append(QString::fromLatin1(index.property.name()));
+    return names;
+}
+
+bool QIfQueryIndex::isIndexed(const QMetaProperty &property) const
+{
+    return d->findIndex(property);
+}
+
+/*!
+    Returns the number of rows in the index, which needs to be the size of the indexed list.
+*/
+qsizetype QIfQueryIndex::count() const
+{
+    return d->m_count;
+}
+
+/*!
+    Removes the row \a row from the index. All following rows move up by one.
+*/
+void QIfQueryIndex::remove(qsizetype row)
+{
+    Q_ASSERT(row >= 0 && row < d->m_count);
+
+    for (QIfQueryIndexPrivate::PropertyIndex &index : d->m_indexes) {
+        QIfQueryIndexPrivate::takeEntry(index, row);
+        for (QIfQueryIndexPrivate::Entry &entry : index.entries) {
+            if (entry.row > row)
+                entry.row--;
+        }
+    }
+    d->m_count--;
+}
+
+/*!
+    Moves the row \a from to the position \a to, the same way as QList::move().
+*/
+void QIfQueryIndex::move(qsizetype from, qsizetype to)
+{
+    Q_ASSERT(from >= 0 && from < d->m_count);
+    Q_ASSERT(to >= 0 && to < d->m_count);
+    if (from == to)
+        return;
+
+    for (QIfQueryIndexPrivate::PropertyIndex &index : d->m_indexes) {
+        QIfQueryIndexPrivate::Entry moved;
+        const bool indexed = QIfQueryIndexPrivate::takeEntry(index, from, &moved);
+        // The rows in between are shifted by one towards the old position. This keeps the order
+        // of the remaining entries, as the rows stay unique.
+        for (QIfQueryIndexPrivate::Entry &entry : index.entries) {
+            if (from < to && entry.row > from && entry.row <= to)
+                entry.row--;
+            else if (from > to && entry.row >= to && entry.row < from)
+                entry.row++;
+        }
+        if (indexed) {
+            moved.row = to;
+            QIfQueryIndexPrivate::insertEntry(index, std::move(moved));
+        }
+    }
+}
+
+/*!
+    Removes all rows from the index.
+*/
+void QIfQueryIndex::clear()
+{
+    for (QIfQueryIndexPrivate::PropertyIndex &index : d->m_indexes)
+        index.entries.clear();
+    d->m_count = 0;
+}
+
+/*!
+    Rebuilds the index for \a count rows. The gadget of every row is returned by \a gadgetAt.
+*/
+void QIfQueryIndex::resetGadgets(qsizetype count, const std::function<const void *(qsizetype row)> &gadgetAt)
+{
+    d->m_count = count;
+    for (QIfQueryIndexPrivate::PropertyIndex &index : d->m_indexes) {
+        index.entries.clear();
+        index.entries.reserve(count);
+        for (qsizetype row = 0; row < count; row++) {
+            if (const void *gadget = gadgetAt(row))
+                index.entries.append({ index.property.readOnGadget(gadget), row });
+        }
+        // The entries are appended in row order, which keeps equal values sorted by their row
+        std::stable_sort(index.entries.begin(), index.entries.end(), [](const QIfQueryIndexPrivate::Entry &left, const QIfQueryIndexPrivate::Entry &right) {
+            return QIfQueryIndexPrivate::compareValues(left.value, right.value) < 0;
+        });
+    }
+}
+
+/*!
+    Inserts the \a gadget as the row \a row into the index. All following rows move down by one.
+
+    If \a gadget is \c nullptr, the row is not indexed and never matches an indexed filter.
+*/
+void QIfQueryIndex::insertGadget(qsizetype row, const void *gadget)
+{
+    Q_ASSERT(row >= 0 && row <= d->m_count);
+
+    for (QIfQueryIndexPrivate::PropertyIndex &index : d->m_indexes) {
+        for (QIfQueryIndexPrivate::Entry &entry : index.entries) {
+            if (entry.row >= row)
+                entry.row++;
+        }
+        if (gadget)
+            QIfQueryIndexPrivate::insertEntry(index, { index.property.readOnGadget(gadget), row });
+    }
+    d->m_count++;
+}
+
+/*!
+    Updates the values of the row \a row with the values of \a gadget.
+*/
+void QIfQueryIndex::updateGadget(qsizetype row, const void *gadget)
+{
+    Q_ASSERT(row >= 0 && row < d->m_count);
+
+    for (QIfQueryIndexPrivate::PropertyIndex &index : d->m_indexes) {
+        QIfQueryIndexPrivate::takeEntry(index, row);
+        if (gadget)
+            QIfQueryIndexPrivate::insertEntry(index, { index.property.readOnGadget(gadget), row });
+    }
+}
+
+QT_END_NAMESPACE
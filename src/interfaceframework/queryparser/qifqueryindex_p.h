@@ -0,0 +1,133 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIFQUERYINDEX_P_H
+#define QIFQUERYINDEX_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtInterfaceFramework/qtifglobal.h>
+
+#include <QtCore/QList>
+#include <QtCore/QMetaProperty>
+#include <QtCore/QSet>
+#include <QtCore/QSharedData>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+
+#include <functional>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+namespace qtif_private {
+    template <typename T>
+    const void *gadgetPointer(const T &item, const QMetaObject *metaObject)
+    {
+        static_assert(QtPrivate::IsGadgetHelper<T>::IsGadgetOrDerivedFrom,
+                      "The items need to be gadgets or QVariants");
+        Q_ASSERT(!metaObject || T::staticMetaObject.inherits(metaObject));
+        Q_UNUSED(metaObject)
+        return std::addressof(item);
+    }
+
+    // Returns nullptr if the variant doesn't hold a gadget of the type metaObject or derived from
+    // it, as reading the properties on anything else is not safe
+    inline const void *gadgetPointer(const QVariant &item, const QMetaObject *metaObject)
+    {
+        const QMetaType type = item.metaType();
+        if (!(type.flags() & QMetaType::IsGadget))
+            return nullptr;
+        const QMetaObject *itemMetaObject = type.metaObject();
+        if (!itemMetaObject || (metaObject && !itemMetaObject->inherits(metaObject)))
+            return nullptr;
+        return item.constData();
+    }
+}
+
+class QIfQueryIndexPrivate : public QSharedData
+{
+public:
+    struct Entry {
+        QVariant value;
+        qsizetype row = 0;
+    };
+
+    // All rows of the list, sorted by the value of one property
+    struct PropertyIndex {
+        QMetaProperty property;
+        QList<Entry> entries;
+    };
+
+    static int compareValues(const QVariant &left, const QVariant &right);
+    static bool lessThan(const Entry &left, const Entry &right);
+    static void insertEntry(PropertyIndex &index, Entry entry);
+    static bool takeEntry(PropertyIndex &index, qsizetype row, Entry *entry = nullptr);
+
+    const PropertyIndex *findIndex(const QMetaProperty &property) const;
+
+    const QMetaObject *m_metaObject = nullptr;
+    QList<PropertyIndex> m_indexes;
+    qsizetype m_count = 0;
+};
+
+class Q_QTINTERFACEFRAMEWORK_EXPORT QIfQueryIndex
+{
+public:
+    QIfQueryIndex();
+    QIfQueryIndex(const QMetaObject *metaObject, const QSet<QString> &properties);
+    QIfQueryIndex(const QIfQueryIndex &other);
+    QIfQueryIndex &operator=(const QIfQueryIndex &other);
+    ~QIfQueryIndex();
+
+    const QMetaObject *metaObject() const;
+    QStringList properties() const;
+    bool isIndexed(const QMetaProperty &property) const;
+    qsizetype count() const;
+
+    template <typename T>
+    void reset(const QList<T> &list)
+    {
+        const QMetaObject *mo = metaObject();
+        resetGadgets(list.size(), [&list, mo](qsizetype row) {
+            return qtif_private::gadgetPointer(list.at(row), mo);
+        });
+    }
+
+    template <typename T>
+    void insert(qsizetype row, const T &item)
+    {
+        insertGadget(row, qtif_private::gadgetPointer(item, metaObject()));
+    }
+
+    template <typename T>
+    void update(qsizetype row, const T &item)
+    {
+        updateGadget(row, qtif_private::gadgetPointer(item, metaObject()));
+    }
+
+    void remove(qsizetype row);
+    void move(qsizetype from, qsizetype to);
+    void clear();
+
+    void resetGadgets(qsizetype count, const std::function<const void *(qsizetype row)> &gadgetAt);
+    void insertGadget(qsizetype row, const void *gadget);
+    void updateGadget(qsizetype row, const void *gadget);
+
+private:
+    QSharedDataPointer<QIfQueryIndexPrivate> d;
+    friend class QIfQueryEvaluator;
+};
+
+QT_END_NAMESPACE
+
+#endif // QIFQUERYINDEX_P_H
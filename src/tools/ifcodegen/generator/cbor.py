@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+# Copyright (C) 2025 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+"""
+Minimal CBOR (RFC 8949) encoder for the JSON compatible data generated by the templates.
+
+The output starts with the self-describe tag, which allows QIfSimulationEngine to detect the
+format independent of the file name.
+"""
+
+import struct
+
+SELF_DESCRIBE_TAG = b'\xd9\xd9\xf7'
+
+
+def _head(major, value):
+    if value < 24:
+        return bytes([major << 5 | value])
+    if value < 0x100:
+        return bytes([major << 5 | 24, value])
+    if value < 0x10000:
+        return struct.pack('>BH', major << 5 | 25, value)
+    if value < 0x100000000:
+        return struct.pack('>BI', major << 5 | 26, value)
+    return struct.pack('>BQ', major << 5 | 27, value)
+
+
+def _encode(obj):
+    if obj is None:
+        return b'\xf6'
+    # bool needs to be checked before int, as bool is a subclass of int
+    if isinstance(obj, bool):
+        return b'\xf5' if obj else b'\xf4'
+    if isinstance(obj, int):
+        if obj >= 0:
+            return _head(0, obj)
+        return _head(1, -1 - obj)
+    if isinstance(obj, float):
+        return b'\xfb' + struct.pack('>d', obj)
+    if isinstance(obj, str):
+        data = obj.encode('utf-8')
+        return _head(3, len(data)) + data
+    if isinstance(obj, (list, tuple)):
+        return _head(4, len(obj)) + b''.join(_encode(item) for item in obj)
+    if isinstance(obj, dict):
+        return _head(5, len(obj)) + b''.join(_encode(str(key)) + _encode(value)
+                                              for key, value in obj.items())
+    raise TypeError('Cannot encode {0} as CBOR'.format(type(obj).__name__))
+
+
+def dumps(obj):
+    """
+    Returns the CBOR encoding of obj
+    """
+    return SELF_DESCRIBE_TAG + _encode(obj)
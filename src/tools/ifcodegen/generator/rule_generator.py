@@ -3,6 +3,7 @@
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 
 import os
+import json
 import click
 import logging.config
 import sys
@@ -13,6 +14,8 @@ from qface.utils import load_filters
 from qface.generator import RuleGenerator
 from qface.idl.domain import Module, Interface, Property, Parameter, Field, Struct
 
+from . import cbor
+
 log = logging.getLogger(__file__)
 
 
@@ -24,6 +27,25 @@ class CustomRuleGenerator(RuleGenerator):
         super().__init__(search_path, destination, context, features, force)
         self.module_names = modules
 
+    def write(self, file_path, template, context={}, preserve=False, force=False):
+        """Documents ending with .cbor are rendered as JSON and written in the CBOR format"""
+        if not file_path or not template or not str(file_path).endswith('.cbor'):
+            return super().write(file_path, template, context, preserve, force)
+
+        if not context:
+            context = self.context
+        path = Path(self.resolved_path) / Path(self.apply(file_path, context))
+        data = cbor.dumps(json.loads(self.render(template, context)))
+        if path.exists() and path.read_bytes() == data:
+            return
+        if path.exists() and preserve and not (self.force or force):
+            click.secho('preserve: {0}'.format(path), fg='blue')
+            return
+        click.secho('create: {0}'.format(path), fg='blue')
+        os.makedirs(os.path.dirname(str(path)), exist_ok=True)
+        with open(str(path), 'wb') as f:
+            f.write(data)
+
     def process_rules(self, path: Path, system):
         gen_config = yaml.load(open(path), Loader=yaml.SafeLoader)
         if 'generate_rules' in gen_config:
@@ -78,8 +78,40 @@ void {{zone_class}}::sync()
 
 void {{zone_class}}::checkSync()
 {
-    if (m_propertiesToSync.isEmpty())
-        Q_EMIT syncDone();
+    if (!m_propertiesToSync.isEmpty())
+        return;
+
+    recordCurrentState();
+    Q_EMIT syncDone();
+}
+
+void {{zone_class}}::applySnapshot(const QVariantMap &properties)
+{
+{% for property in interface.properties %}
+{%   if not property.type.is_model %}
+    m_{{property}} = properties.value(u"{{property}}"_s).value<{{property|return_type}}>();
+{%   endif %}
+{% endfor %}
+    recordCurrentState();
+}
+
+void {{zone_class}}::applyChanges(const QVariantMap &changes)
+{
+{% for property in interface.properties %}
+{%   if not property.type.is_model %}
+    if (auto it = changes.constFind(u"{{property}}"_s); it != changes.cend())
+        m_{{property}} = it->value<{{property|return_type}}>();
+{%   endif %}
+{% endfor %}
+}
+
+void {{zone_class}}::recordCurrentState()
+{
+{% for property in interface.properties %}
+{%   if not property.type.is_model %}
+    m_parent->recordProperty(u"{{property}}"_s, QVariant::fromValue(m_{{property}}), m_zone);
+{%   endif %}
+{% endfor %}
 }
 
 void {{zone_class}}::emitCurrentState()
@@ -94,13 +126,15 @@ void {{zone_class}}::emitCurrentState()
 {
     m_{{property}} = {{property}};
     Q_EMIT m_parent->{{property}}Changed({{property}}, m_zone);
+{%   if not property.type.is_model %}
+    m_parent->recordProperty(u"{{property}}"_s, QVariant::fromValue(m_{{property}}), m_zone);
+{%   endif %}
 }
 {% endfor %}
 {% endif %}
 
 {{class}}::{{class}}(const QString &remoteObjectsLookupName, QObject *parent)
     : {{interface}}BackendInterface(parent)
-    , m_node(nullptr)
     , m_remoteObjectsLookupName(remoteObjectsLookupName)
     , m_helper(new QIfRemoteObjectsReplicaHelper(qLcRO{{interface}}(), this))
 {% for property in interface.properties %}
@@ -117,6 +151,8 @@ void {{zone_class}}::emitCurrentState()
 {% endif %}
 {
     {{module.module_name|upperfirst}}::registerTypes();
+    // Allows features which resume their backend updates to catch up without a full initialize()
+    setPropertyStateTrackingEnabled(true);
 
 {% if interface_zoned %}
     auto zoneObject = new {{zone_class}}(QString(), this);
@@ -127,7 +163,10 @@ void {{zone_class}}::emitCurrentState()
 
 {{class}}::~{{class}}()
 {
-    delete m_node;
+{% if interface_zoned %}
+    m_zoneSnapshotReplica.reset();
+{% endif %}
+    m_replica.reset();
 }
 
 void {{class}}::initialize()
@@ -162,6 +201,7 @@ void {{class}}::updateServiceSettings(const QVariantMap &settings)
         return;
 
     m_serviceSettings = settings;
+    m_helper->applyServiceSettings(m_serviceSettings, { u"{{interface.qualified_name}}"_s, u"{{interface}}"_s, u"{{module}}"_s });
     connectToNode();
 
 {% for property in interface.properties %}
@@ -176,6 +216,22 @@ void {{class}}::syncZones()
 {
     if (m_replica.isNull())
         return;
+
+    // Servers which provide a snapshot of all zones allow to sync all zones with a single call,
+    // otherwise every property of every zone is synced separately
+    if (m_replica->zoneSnapshotAvailable()) {
+        if (m_zoneSnapshotReplica.isNull()) {
+            m_zoneSnapshotReplica.reset(m_node->acquire<{{interface}}ZoneSnapshotReplica>(m_remoteObjectsLookupName + u".zoneSnapshot"_s));
+            connect(m_zoneSnapshotReplica.data(), &QRemoteObjectReplica::stateChanged, this, [this](QRemoteObjectReplica::State newState) {
+                if (newState == QRemoteObjectReplica::Valid && !m_synced)
+                    syncZoneSnapshot();
+            });
+        }
+        if (m_zoneSnapshotReplica->state() == QRemoteObjectReplica::Valid)
+            syncZoneSnapshot();
+        return;
+    }
+
     QRemoteObjectPendingReply<QStringList> zoneReply = m_replica->availableZones();
     auto zoneWatcher = new QRemoteObjectPendingCallWatcher(zoneReply, this);
     connect(zoneWatcher, &QRemoteObjectPendingCallWatcher::finished, this, [this, zoneReply](QRemoteObjectPendingCallWatcher *self) mutable {
@@ -191,8 +247,8 @@ void {{class}}::syncZones()
                 }
                 Q_EMIT availableZonesChanged(m_zones);
 
-                for (const QString& zone : m_zoneMap.keys())
-                    m_zoneMap.value(zone)->sync();
+                for ({{zone_class}} *zoneObject : std::as_const(m_zoneMap))
+                    zoneObject->sync();
             } else {
                 onZoneSyncDone();
             }
@@ -201,6 +257,37 @@ void {{class}}::syncZones()
     });
 }
 
+void {{class}}::syncZoneSnapshot()
+{
+    if (m_zoneSnapshotReplica.isNull())
+        return;
+    // The snapshot contains the available zones and the values of all properties in all zones
+    QRemoteObjectPendingReply<QVariantMap> snapshotReply = m_zoneSnapshotReplica->zoneSnapshot();
+    auto snapshotWatcher = new QRemoteObjectPendingCallWatcher(snapshotReply, this);
+    connect(snapshotWatcher, &QRemoteObjectPendingCallWatcher::finished, this, [this, snapshotReply](QRemoteObjectPendingCallWatcher *self) mutable {
+        if (self->error() == QRemoteObjectPendingCallWatcher::NoError) {
+            if (!m_synced) {
+                const QVariantMap snapshot = snapshotReply.returnValue();
+                m_zones = snapshot.value(u"zones"_s).toStringList();
+                for (const QString& zone : std::as_const(m_zones)) {
+                    if (m_zoneMap.contains(zone))
+                        continue;
+                    auto zoneObject = new {{zone_class}}(zone, this);
+                    m_zoneMap.insert(zone, zoneObject);
+                    connect(zoneObject, &{{zone_class}}::syncDone, this, &{{class}}::onZoneSyncDone);
+                }
+                Q_EMIT availableZonesChanged(m_zones);
+
+                const QVariantMap properties = snapshot.value(u"properties"_s).toMap();
+                for (auto it = m_zoneMap.cbegin(); it != m_zoneMap.cend(); ++it)
+                    it.value()->applySnapshot(properties.value(it.key()).toMap());
+            }
+            onZoneSyncDone();
+        }
+        self->deleteLater();
+    });
+}
+
 QStringList {{class}}::availableZones() const
 {
     return m_zones;
@@ -324,16 +411,22 @@ bool {{class}}::connectToNode()
         url = QIfRemoteObjectsHelper::buildDefaultUrl(u"{{module.module_name|lower}}"_s);
 
     if (m_url != url) {
-        // QtRO doesn't allow to change the URL without destroying the Node
+        // QtRO doesn't allow to change the URL of a Node. The node is shared with all other
+        // backends connected to the same URL and is destroyed once it is no longer used.
         if (m_node) {
             qCInfo(qLcRO{{interface}}) << "Disconnecting from" << m_url;
-            delete m_node;
+            disconnect(m_node.data(), nullptr, m_helper, nullptr);
+{% if interface_zoned %}
+            m_zoneSnapshotReplica.reset();
+{% endif %}
+            m_replica.reset();
+            m_node.reset();
         }
 
         m_url = url;
 
-        m_node = new QRemoteObjectNode();
-        if (!m_node->connectToNode(m_url)) {
+        m_node = QIfRemoteObjectsHelper::acquireNode(m_url);
+        if (!m_node) {
             qCCritical(qLcRO{{interface}}) << "Connection to" << m_url << "failed!";
             m_replica.reset();
 {% if interface_zoned %}
@@ -370,7 +463,7 @@ bool {{class}}::connectToNode()
 
 void {{class}}::setupConnections()
 {
-    connect(m_node, &QRemoteObjectNode::error, m_helper, &QIfRemoteObjectsReplicaHelper::onNodeError);
+    connect(m_node.data(), &QRemoteObjectNode::error, m_helper, &QIfRemoteObjectsReplicaHelper::onNodeError);
     connect(m_helper, &QIfRemoteObjectsReplicaHelper::errorChanged, this, &QIfFeatureInterface::errorChanged);
 
     connect(m_replica.data(), &QRemoteObjectReplica::stateChanged, m_helper, &QIfRemoteObjectsReplicaHelper::onReplicaStateChanged);
@@ -384,7 +477,14 @@ void {{class}}::setupConnections()
     });
 {% else %}
     //As the Replica is now initialized, this will trigger an update of all properties (not just the changed ones)
-    connect(m_replica.data(), &QRemoteObjectReplica::initialized, this, &{{class}}::initialize);
+    connect(m_replica.data(), &QRemoteObjectReplica::initialized, this, [this]() {
+        // Record the new values as well, features which resume their backend updates only
+        // catch up with the recorded changes
+{% for property in interface.properties if not property.type.is_model %}
+        recordProperty(u"{{property}}"_s, QVariant::fromValue(m_replica->{{property}}()));
+{% endfor %}
+        initialize();
+    });
 {% endif %}
 {% for property in interface.properties if not property.type.is_model %}
 {%   if interface_zoned %}
@@ -397,9 +497,26 @@ void {{class}}::setupConnections()
         zoneObject->{{property|setter_name}}({{property}});
     });
 {%   else %}
-    connect(m_replica.data(), &{{interface}}Replica::{{property}}Changed, this, &{{class}}::{{property}}Changed);
+    connect(m_replica.data(), &{{interface}}Replica::{{property}}Changed, this, [this]({{property|parameter_type}}) {
+        Q_EMIT {{property}}Changed({{property}});
+        recordProperty(u"{{property}}"_s, QVariant::fromValue({{property}}));
+    });
 {%   endif %}
 {% endfor %}
+{% if interface_zoned %}
+    connect(m_replica.data(), &{{interface}}Replica::propertiesChanged, this, [this](const QVariantMap &changes, const QString &zone) {
+        auto zoneObject = m_zoneMap.value(zone);
+        if (!zoneObject) {
+            qCCritical(qLcRO{{interface}}) << "Backend got a change set for a zone which doesn't exist. Ignoring it.";
+            return;
+        }
+        zoneObject->applyChanges(changes);
+        beginPropertyUpdate();
+        for (auto it = changes.cbegin(); it != changes.cend(); ++it)
+            updateProperty(it.key(), it.value(), zone);
+        commitPropertyUpdate();
+    });
+{% endif %}
 {% for signal in interface.signals %}
     connect(m_replica.data(), &{{interface}}Replica::{{signal}}, this, &{{class}}::{{signal}});
 {% endfor %}
@@ -408,17 +525,15 @@ void {{class}}::setupConnections()
 {% if interface_zoned %}
 void {{class}}::onZoneSyncDone()
 {
-    const QStringList zones = m_zoneMap.keys();
-
-    for (const QString& zone : zones) {
-        if (m_zoneMap.value(zone)->isSyncing())
+    for ({{zone_class}} *zoneObject : std::as_const(m_zoneMap)) {
+        if (zoneObject->isSyncing())
             return;
     }
 
     m_synced = true;
 
-    for (const QString& zone : zones)
-        m_zoneMap.value(zone)->emitCurrentState();
+    for ({{zone_class}} *zoneObject : std::as_const(m_zoneMap))
+        zoneObject->emitCurrentState();
     Q_EMIT initializationDone();
 }
 {% endif %}
@@ -44,6 +44,8 @@ public:
 
     bool isSyncing();
     void sync();
+    void applySnapshot(const QVariantMap &properties);
+    void applyChanges(const QVariantMap &changes);
 
 public Q_SLOTS:
 {% for property in interface.properties %}
@@ -56,6 +58,7 @@ Q_SIGNALS:
 
 private:
     void checkSync();
+    void recordCurrentState();
 
     {{class}} *m_parent;
     QString m_zone;
@@ -102,6 +105,7 @@ public Q_SLOTS:
 protected Q_SLOTS:
 {% if interface_zoned %}
     void syncZones();
+    void syncZoneSnapshot();
     void onZoneSyncDone();
 {% endif %}
 
@@ -110,7 +114,10 @@ protected:
     void setupConnections();
 
     QSharedPointer<{{interface}}Replica> m_replica;
-    QRemoteObjectNode* m_node= nullptr;
+{% if interface_zoned %}
+    QSharedPointer<{{interface}}ZoneSnapshotReplica> m_zoneSnapshotReplica;
+{% endif %}
+    QSharedPointer<QRemoteObjectNode> m_node;
     QUrl m_url;
     QString m_remoteObjectsLookupName;
     QHash<quint64, QIfPendingReplyBase> m_pendingReplies;
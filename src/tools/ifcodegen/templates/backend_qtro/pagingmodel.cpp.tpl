@@ -17,16 +17,26 @@ Q_LOGGING_CATEGORY(qLcRO{{interface}}{{property|upper_first}}, "{{module|qml_typ
 {{class}}::{{class}}(const QString &remoteObjectsLookupName, QObject* parent)
     : QIfPagingModelInterface(parent)
     , m_helper(new QIfRemoteObjectsReplicaHelper(qLcRO{{interface}}{{property|upper_first}}(), this))
-    , m_node(nullptr)
     , m_remoteObjectsLookupName(remoteObjectsLookupName)
 {
     qRegisterMetaType<QIfPagingModelInterface*>();
+
+    // Tells the server that this client still uses its instances, otherwise they are removed
+    m_keepAliveTimer.setTimerType(Qt::CoarseTimer);
+    m_keepAliveTimer.setInterval(QIfRemoteObjectsHelper::instanceKeepAliveInterval);
+    connect(&m_keepAliveTimer, &QTimer::timeout, this, [this]() {
+        for (const auto &replica : std::as_const(m_instanceReplicas)) {
+            if (replica->isInitialized())
+                replica->keepAlive();
+        }
+    });
 }
 
 /*! \internal */
 {{class}}::~{{class}}()
 {
-    delete m_node;
+    m_instanceReplicas.clear();
+    m_replica.reset();
 }
 
 void {{class}}::initialize()
@@ -43,12 +53,14 @@ void {{class}}::registerInstance(const QUuid &identifier)
     if (m_replica.isNull())
         return;
     m_replica->registerInstance(identifier);
+    acquireInstanceReplica(identifier);
 }
 
 void {{class}}::unregisterInstance(const QUuid &identifier)
 {
     if (m_replica.isNull())
         return;
+    removeInstanceReplica(identifier);
     m_replica->unregisterInstance(identifier);
 }
 
@@ -135,16 +147,21 @@ bool {{class}}::connectToNode()
         url = QIfRemoteObjectsHelper::buildDefaultUrl(u"{{module.module_name|lower}}"_s);
 
     if (m_url != url) {
-        // QtRO doesn't allow to change the URL without destroying the Node
+        // QtRO doesn't allow to change the URL of a Node. The node is shared with all other
+        // backends connected to the same URL and is destroyed once it is no longer used.
         if (m_node) {
             qCInfo(qLcRO{{interface}}{{property|upper_first}}) << "Disconnecting from" << m_url;
-            delete m_node;
+            disconnect(m_node.data(), nullptr, m_helper, nullptr);
+            m_instanceReplicas.clear();
+            m_keepAliveTimer.stop();
+            m_replica.reset();
+            m_node.reset();
         }
 
         m_url = url;
 
-        m_node = new QRemoteObjectNode();
-        if (!m_node->connectToNode(m_url)) {
+        m_node = QIfRemoteObjectsHelper::acquireNode(m_url);
+        if (!m_node) {
             qCCritical(qLcRO{{interface}}{{property|upper_first}}) << "Connection to" << m_url << "failed!";
             m_replica.reset();
             return false;
@@ -166,6 +183,7 @@ bool {{class}}::connectToNode()
         if (connectionTimeout == defaultTimeout)
             connectionTimeout = m_serviceSettings.value(u"connectionTimeout"_s, defaultTimeout).toInt();
 
+        m_connectionTimeout = connectionTimeout;
         if (connectionTimeout != -1) {
             QTimer::singleShot(connectionTimeout, this, [this](){
                 if(!m_replica->isInitialized())
@@ -179,7 +197,7 @@ bool {{class}}::connectToNode()
 void {{class}}::setupConnections()
 {
     connect(m_replica.data(), &QRemoteObjectReplica::initialized, this, &QIfFeatureInterface::initializationDone);
-    connect(m_node, &QRemoteObjectNode::error, m_helper, &QIfRemoteObjectsReplicaHelper::onNodeError);
+    connect(m_node.data(), &QRemoteObjectNode::error, m_helper, &QIfRemoteObjectsReplicaHelper::onNodeError);
     connect(m_helper, &QIfRemoteObjectsReplicaHelper::errorChanged, this, &QIfFeatureInterface::errorChanged);
     connect(m_replica.data(), &QRemoteObjectReplica::stateChanged, m_helper, &QIfRemoteObjectsReplicaHelper::onReplicaStateChanged);
 
@@ -188,3 +206,45 @@ void {{class}}::setupConnections()
     connect(m_replica.data(), &QIfPagingModelReplica::dataFetched, this, &{{class}}::dataFetched);
     connect(m_replica.data(), &QIfPagingModelReplica::dataChanged, this, &{{class}}::dataChanged);
 }
+
+void {{class}}::acquireInstanceReplica(const QUuid &identifier)
+{
+    if (identifier.isNull() || m_instanceReplicas.contains(identifier))
+        return;
+
+    // All updates for this instance are delivered using a separate source, which is only
+    // connected to this client. Until the server knows about this connection, it will broadcast
+    // the updates using the shared replica instead.
+    QSharedPointer<QIfPagingModelInstanceReplica> replica(m_node->acquire<QIfPagingModelInstanceReplica>(QIfRemoteObjectsHelper::instanceLookupName(m_remoteObjectsLookupName, identifier)));
+    connect(replica.data(), &QIfPagingModelInstanceReplica::supportedCapabilitiesChanged, this, &{{class}}::supportedCapabilitiesChanged);
+    connect(replica.data(), &QIfPagingModelInstanceReplica::countChanged, this, &{{class}}::countChanged);
+    connect(replica.data(), &QIfPagingModelInstanceReplica::dataFetched, this, &{{class}}::dataFetched);
+    connect(replica.data(), &QIfPagingModelInstanceReplica::dataChanged, this, &{{class}}::dataChanged);
+    connect(replica.data(), &QRemoteObjectReplica::initialized, replica.data(), [replica = replica.data()]() {
+        // The first call lets the server send all updates for this instance using this replica
+        replica->keepAlive();
+    });
+    m_instanceReplicas.insert(identifier, replica);
+    if (!m_keepAliveTimer.isActive())
+        m_keepAliveTimer.start();
+
+    // A server which doesn't remote the instance sources, e.g. a custom server which doesn't use
+    // QIfPagingModelQtRoAdapter::enableRemoting(), will never initialize this replica. All updates
+    // are still broadcasted using the shared replica in this case.
+    if (m_connectionTimeout != -1) {
+        QTimer::singleShot(m_connectionTimeout, replica.data(), [this, identifier, replica = replica.data()]() {
+            if (replica->isInitialized() || m_instanceReplicas.value(identifier).data() != replica)
+                return;
+            qCDebug(qLcRO{{interface}}{{property|upper_first}}) << "The instance source for" << identifier
+                                        << "isn't available. Using the shared replica instead.";
+            removeInstanceReplica(identifier);
+        });
+    }
+}
+
+void {{class}}::removeInstanceReplica(const QUuid &identifier)
+{
+    m_instanceReplicas.remove(identifier);
+    if (m_instanceReplicas.isEmpty())
+        m_keepAliveTimer.stop();
+}
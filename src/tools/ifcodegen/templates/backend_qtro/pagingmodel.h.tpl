@@ -3,6 +3,7 @@
 # Copyright (C) 2019 Luxoft Sweden AB
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 #}
+{% import 'common/qtif_macros.j2' as qtif %}
 {% set interface_zoned = interface.tags.config and interface.tags.config.zoned  %}
 {% if interface_zoned %}
 {% set class = 'Zoned{0}RoModelBackend'.format(property|upperfirst) %}
@@ -11,7 +12,8 @@
 {% endif %}
 
 #include <QIfPagingModelInterface>
-#include "{{property.type.nested|lower}}.h"
+#include <QTimer>
+{{ qtif.struct_include(property.type.nested.reference, module) }}
 
 #include "QtIfRemoteObjectsHelper/rep_qifpagingmodel_replica.h"
 
@@ -37,13 +39,18 @@ public:
 private:
     bool connectToNode();
     void setupConnections();
+    void acquireInstanceReplica(const QUuid &identifier);
+    void removeInstanceReplica(const QUuid &identifier);
 
     QSharedPointer<QIfPagingModelReplica> m_replica;
+    QHash<QUuid, QSharedPointer<QIfPagingModelInstanceReplica>> m_instanceReplicas;
     QIfRemoteObjectsReplicaHelper *m_helper;
     QVariantMap m_serviceSettings;
-    QRemoteObjectNode *m_node= nullptr;
+    QSharedPointer<QRemoteObjectNode> m_node;
     QString m_remoteObjectsLookupName;
     QUrl m_url;
+    int m_connectionTimeout = -1;
+    QTimer m_keepAliveTimer;
     QVariantList m_list;
 };
 
@@ -52,7 +52,7 @@ extern {{class}}::InterfaceBuilder {{module.tags.config.interfaceBuilder}};
 {% else %}
 {%   set simulationFile = "qrc:///simulation/" + module.module_name|lower + '_simulation.qml' %}
 {% endif %}
-    m_simulationEngine->loadSimulationData(u":/simulation/{{module.module_name|lower}}_simulation_data.json"_s);
+    m_simulationEngine->loadSimulationData(u":/simulation/{{module.module_name|lower}}_simulation_data.cbor"_s);
     m_simulationEngine->loadSimulation(QUrl(u"{{simulationFile}}"_s));
 {% endif %}
 }
@@ -22,4 +22,5 @@ RESOURCES += $$PWD/{{module.module_name|lower}}_simulation.qrc
 
 OTHER_FILES += \
     $$PWD/{{module.module_name|lower}}.json \
-    $$PWD/{{module.module_name|lower}}_simulation_data.json
+    $$PWD/{{module.module_name|lower}}_simulation_data.json \
+    $$PWD/{{module.module_name|lower}}_simulation_data.cbor
@@ -15,6 +15,8 @@
 #include <QDebug>
 #include <QtInterfaceFramework/QIfSimulationEngine>
 
+using namespace Qt::StringLiterals;
+
 {% for property in interface.properties %}
 {%   if property.type.is_model %}
 {% include "common/pagingmodel_simulation.cpp.tpl" %}
@@ -57,6 +59,9 @@
     m_{{property}} = {{property}};
     Q_EMIT {{property}}Changed({{property}});
     Q_EMIT m_parent->{{property}}Changed({{property}}, m_zone);
+{%   if not property.type.is_model %}
+    m_parent->recordProperty(u"{{property}}"_s, QVariant::fromValue(m_{{property}}), m_zone);
+{%   endif %}
 }
 {% endfor %}
 {% endif %}
@@ -80,6 +85,8 @@
     //In some cases the engine is unused, this doesn't do any harm if it is still used
     Q_UNUSED(engine)
     qRegisterMetaType<QQmlPropertyMap*>();
+    // Allows features which resume their backend updates to catch up without a full initialize()
+    setPropertyStateTrackingEnabled(true);
 
 {% for property in interface.properties %}
 {%   if not property.tags.config_simulator or not property.tags.config_simulator.zoned %}
@@ -210,6 +217,9 @@ void {{class}}::addZone(const QString &zone)
             return;
         m_{{property}} = {{property}};
         Q_EMIT {{property}}Changed({{property}}, QString());
+{%   if not property.type.is_model %}
+        recordProperty(u"{{property}}"_s, QVariant::fromValue(m_{{property}}), QString());
+{%   endif %}
     } else {
         {{interface}}Zone *zo = zoneAt(zone);
         if (zo)
@@ -222,6 +232,9 @@ void {{class}}::addZone(const QString &zone)
         return;
     m_{{property}} = {{property}};
     Q_EMIT {{property}}Changed(m_{{property}});
+{%   if not property.type.is_model %}
+    recordProperty(u"{{property}}"_s, QVariant::fromValue(m_{{property}}));
+{%   endif %}
 {% endif %}
 }
 
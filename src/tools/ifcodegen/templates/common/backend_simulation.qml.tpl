@@ -16,7 +16,7 @@ import {{module|qml_type}}.simulation
 
     property QtObject d: QtObject {
         id: d
-        property var settings: IfSimulator.findData(IfSimulator.simulationData, "{{interface}}")
+        property var settings: IfSimulator.findInterfaceData("{{interface}}")
         property bool defaultInitialized: false
         property LoggingCategory qLc{{interface|upperfirst}}: LoggingCategory {
             name: "{{module|qml_type|lower}}.simulation.{{interface|lower}}backend"
@@ -41,8 +41,8 @@ import {{module|qml_type}}.simulation
 
 {% if interface_zoned %}
     function {{property|setter_name}}({{property}}, zone) {
-        if ("{{property}}" in d.settings && !IfSimulator.checkSettings(d.settings["{{property}}"], {{property}}, zone)) {
-            console.error(d.qLc{{interface|upperfirst}}, "SIMULATION changing {{property}} is not possible: provided: " + {{property}} + " constraint: " + IfSimulator.constraint(d.settings["{{property}}"], zone));
+        if (!IfSimulator.checkProperty("{{interface}}", "{{property}}", {{property}}, zone)) {
+            console.error(d.qLc{{interface|upperfirst}}, "SIMULATION changing {{property}} is not possible: provided: " + {{property}} + " constraint: " + IfSimulator.propertyConstraint("{{interface}}", "{{property}}", zone));
             return;
         }
 
@@ -56,8 +56,8 @@ import {{module|qml_type}}.simulation
     }
 {% else %}
     function {{property|setter_name}}({{property}}) {
-        if ("{{property}}" in d.settings && !IfSimulator.checkSettings(d.settings["{{property}}"], {{property}})) {
-            console.error(d.qLc{{interface|upperfirst}}, "SIMULATION changing {{property}} is not possible: provided: " + {{property}} + " constraint: " + IfSimulator.constraint(d.settings["{{property}}"]));
+        if (!IfSimulator.checkProperty("{{interface}}", "{{property}}", {{property}})) {
+            console.error(d.qLc{{interface|upperfirst}}, "SIMULATION changing {{property}} is not possible: provided: " + {{property}} + " constraint: " + IfSimulator.propertyConstraint("{{interface}}", "{{property}}"));
             return;
         }
 
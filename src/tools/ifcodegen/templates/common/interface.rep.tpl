@@ -40,6 +40,8 @@ class {{class}}
 
 {% if interface_zoned %}
     SLOT(QStringList availableZones())
+{#   Set by servers which remote a {{class}}ZoneSnapshot source as well #}
+    PROP(bool zoneSnapshotAvailable=false READONLY)
 {% endif %}
 
 {% for operation in interface.operations %}
@@ -47,7 +49,20 @@ class {{class}}
 {% endfor %}
 
     SIGNAL(pendingResultAvailable(quint64 id, bool isSuccess, const QVariant &value))
+{% if interface_zoned %}
+{#   Properties of non-zoned interfaces are synced by QtRO itself #}
+    SIGNAL(propertiesChanged(const QVariantMap &changes, const QString &zone))
+{% endif %}
 {% for signal in interface.signals %}
     SIGNAL({{signal}}({{qtif.join_params(signal, zoned = interface_zoned)}}))
 {% endfor %}
 };
+{% if interface_zoned %}
+
+{# Remoted next to the {{class}} source using the "<lookup name>.zoneSnapshot" lookup name.
+   A separate class keeps custom servers compiling, as they don't need to implement the slot. #}
+class {{class}}ZoneSnapshot
+{
+    SLOT(QVariantMap zoneSnapshot())
+};
+{% endif %}
@@ -5,6 +5,7 @@
 # Copyright (C) 2017 Klaralvdalens Datakonsult AB (KDAB).
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 #}
+{% import 'common/qtif_macros.j2' as qtif %}
 {% set interface_zoned = interface.tags.config and interface.tags.config.zoned  %}
 {% if interface_zoned %}
 {% set class = 'Zoned{0}ModelBackend'.format(property|upperfirst) %}
@@ -13,7 +14,7 @@
 {% endif %}
 
 #include <QIfPagingModelInterface>
-#include "{{property.type.nested|lower}}.h"
+{{ qtif.struct_include(property.type.nested.reference, module) }}
 
 {{ module|begin_namespace }}
 
@@ -32,17 +33,17 @@ public:
     Q_INVOKABLE void unregisterInstance(const QUuid &identifier) override;
 
     Q_INVOKABLE void fetchData(const QUuid &identifier, int start, int count) override;
-    Q_INVOKABLE {{property.type.nested}} at(int index) const;
+    Q_INVOKABLE {{property.type.nested.reference|add_namespace_prefix}} at(int index) const;
 
 public Q_SLOTS:
-    void insert(int index, const {{property.type.nested}} &item);
+    void insert(int index, const {{property.type.nested.reference|add_namespace_prefix}} &item);
     void remove(int index);
     void move(int currentIndex, int newIndex);
     void reset();
-    void update(int index, const {{property.type.nested}} &item);
+    void update(int index, const {{property.type.nested.reference|add_namespace_prefix}} &item);
 
 private:
-    QList<{{property.type.nested}}> m_list;
+    QList<{{property.type.nested.reference|add_namespace_prefix}}> m_list;
 };
 
 {{ module|end_namespace }}
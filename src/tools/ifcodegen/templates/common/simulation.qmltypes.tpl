@@ -29,6 +29,11 @@ Module {
             Parameter { name: "data"; type: "QVariantMap" }
             Parameter { name: "interface"; type: "string" }
         }
+        Method {
+            name: "findInterfaceData"
+            type: "QVariantMap"
+            Parameter { name: "interface"; type: "string" }
+        }
         Method {
             name: "initializeDefault"
             Parameter { name: "data"; type: "QVariantMap" }
@@ -60,6 +65,21 @@ Module {
             Parameter { name: "domain"; type: "string" }
             Parameter { name: "zone"; type: "string" }
         }
+        Method {
+            name: "checkProperty"
+            type: "bool"
+            Parameter { name: "interface"; type: "string" }
+            Parameter { name: "property"; type: "string" }
+            Parameter { name: "value"; type: "QVariant" }
+            Parameter { name: "zone"; type: "string" }
+        }
+        Method {
+            name: "propertyConstraint"
+            type: "string"
+            Parameter { name: "interface"; type: "string" }
+            Parameter { name: "property"; type: "string" }
+            Parameter { name: "zone"; type: "string" }
+        }
     }
 
 {% for interface in module.interfaces %}
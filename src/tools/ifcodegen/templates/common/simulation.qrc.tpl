@@ -6,7 +6,7 @@
 #}
 <RCC>
     <qresource prefix="/simulation">
-        <file>{{module.module_name|lower}}_simulation_data.json</file>
+        <file compression-algorithm="none">{{module.module_name|lower}}_simulation_data.cbor</file>
         <file>{{module.module_name|lower}}_simulation.qml</file>
 {% for iface in module.interfaces %}
         <file>{{iface|upperfirst}}Simulation.qml</file>
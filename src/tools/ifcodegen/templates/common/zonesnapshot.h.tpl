@@ -0,0 +1,69 @@
+{#
+# Copyright (C) 2025 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+#}
+{% include "common/generated_comment.cpp.tpl" %}
+#ifndef ZONESNAPSHOT_H
+#define ZONESNAPSHOT_H
+
+{% for interface in module.interfaces if interface.tags.config and interface.tags.config.zoned %}
+#include "rep_{{interface|lower}}_source.h"
+{% endfor %}
+
+{{ module|begin_namespace }}
+
+{% for interface in module.interfaces if interface.tags.config and interface.tags.config.zoned %}
+{%   set class = '{0}ZoneSnapshotProvider'.format(interface) %}
+/*
+* Provides the values of all properties in all zones of a {{interface}}Source with a single
+* call, using the getters of the source.
+*
+* Remote it next to the source using remoteObjectsLookupName() and set the zoneSnapshotAvailable
+* property of the source to true. Replicas of sources without a snapshot provider sync every
+* property of every zone separately.
+*/
+class {{class}} : public {{interface}}ZoneSnapshotSource
+{
+public:
+    explicit {{class}}({{interface}}Source *source)
+        : {{interface}}ZoneSnapshotSource(source)
+        , m_source(source)
+    {}
+
+    static QString remoteObjectsLookupName(const QString &sourceLookupName = QStringLiteral("{{interface.qualified_name}}"))
+    {
+        return sourceLookupName + QStringLiteral(".zoneSnapshot");
+    }
+
+    QVariantMap zoneSnapshot() override
+    {
+        auto zoneProperties = [this](const QString &zone) {
+            QVariantMap properties;
+{%   for property in interface.properties %}
+{%     if not property.is_model %}
+            properties.insert(QStringLiteral("{{property}}"), QVariant::fromValue(m_source->{{property|getter_name}}(zone)));
+{%     endif %}
+{%   endfor %}
+            return properties;
+        };
+
+        const QStringList zones = m_source->availableZones();
+        QVariantMap zoneMap;
+        zoneMap.insert(QString(), zoneProperties(QString()));
+        for (const QString &zone : zones)
+            zoneMap.insert(zone, zoneProperties(zone));
+
+        return QVariantMap {
+            { QStringLiteral("zones"), zones },
+            { QStringLiteral("properties"), zoneMap }
+        };
+    }
+
+private:
+    {{interface}}Source *m_source;
+};
+
+{% endfor %}
+{{ module|end_namespace }}
+
+#endif // ZONESNAPSHOT_H
@@ -15,6 +15,12 @@
 #include <QQmlEngine>
 #include <QIfServiceObject>
 #include <QIfProxyServiceObject>
+#include <QIfTypedPagingModel>
+{% for property in interface.properties %}
+{%   if property.type.is_model and property.type.nested.is_struct %}
+{{ qtif.struct_include(property.type.nested.reference, module) }}
+{%   endif %}
+{% endfor %}
 
 using namespace Qt::StringLiterals;
 
@@ -57,6 +63,10 @@ using namespace Qt::StringLiterals;
     , m_{{property}}({{property|default_type_value}})
 {% endfor %}
 {
+{% if not module.tags.config.disablePrivateIF %}
+    // The property setters use the write throttle
+    m_supportsPropertyWritePolicies = true;
+{% endif %}
     {{module.module_name|upperfirst}}::registerTypes();
 }
 
@@ -128,7 +138,11 @@ void {{class}}Private::clearToDefaults()
 {% if property.type.is_model %}
     {{property|return_type}} old = {{class}}Private::get(f)->m_{{property}};
     if ({{property}}) {
+{%   if property.type.nested.is_struct %}
+        auto model = new QIfTypedPagingModel<{{property.type.nested.reference|add_namespace_prefix}}>();
+{%   else %}
         auto model = new QIfPagingModel();
+{%   endif %}
         model->setServiceObject(new QIfProxyServiceObject({ {QIfPagingModel_iid, {{property}} } }));;
         {{class}}Private::get(f)->m_{{property}} = model;
         Q_EMIT f->{{property}}Changed(model);
@@ -153,7 +167,11 @@ void {{class}}Private::clearToDefaults()
 {% if property.type.is_model %}
     {{property|return_type}} old = m_{{property}};
     if ({{property}}) {
+{%   if property.type.nested.is_struct %}
+        auto model = new QIfTypedPagingModel<{{property.type.nested.reference|add_namespace_prefix}}>();
+{%   else %}
         auto model = new QIfPagingModel();
+{%   endif %}
         model->setServiceObject(new QIfProxyServiceObject({ {QIfPagingModel_iid, {{property}} } }));
         m_{{property}} = model;
         auto q = getParent();
@@ -200,7 +218,62 @@ void {{class}}Private::on{{signal|upperfirst}}({{qtif.join_params(signal)}})
 {%   endif %}
 
 {% endfor %}
+/*! \internal */
+void {{class}}Private::onPropertiesChanged(const QVariantMap &changes, const QString &zone)
+{
+{% if interface.tags.config.zoned %}
+    auto q = getParent();
+    auto f = qobject_cast<{{class}}*>(q->zoneAt(zone));
+    if (!f)
+        f = q;
+    if (f->zone() != zone)
+        return;
+    auto d = {{class}}Private::get(f);
+{% else %}
+    Q_UNUSED(zone)
+    auto f = getParent();
+    auto d = this;
+{% endif %}
+{% set batched_properties = interface.properties|rejectattr('type.is_model')|list %}
+{% if batched_properties %}
+
+    // Apply all values before notifying about them, to make sure that every change signal
+    // already sees the complete new state.
+{%   for property in batched_properties %}
+    bool {{property}}Changed = false;
+{%   endfor %}
+    QVariantMap::const_iterator it;
+{%   for property in batched_properties %}
+    it = changes.constFind(u"{{property}}"_s);
+    if (it != changes.cend()) {
+        auto value = it->value<{{property|return_type}}>();
+        if (d->m_{{property}} != value) {
+            d->m_{{property}} = std::move(value);
+            {{property}}Changed = true;
+        }
+    }
+{%   endfor %}
+
+{%   for property in batched_properties %}
+    if ({{property}}Changed)
+        Q_EMIT f->{{property}}Changed(d->m_{{property}});
+{%   endfor %}
+{% else %}
+    Q_UNUSED(changes)
+    Q_UNUSED(d)
+    Q_UNUSED(f)
+{% endif %}
+}
 
+{% if not module.tags.config.disablePrivateIF %}
+/*! \internal */
+bool {{class}}Private::applyPropertyChanges(const QVariantMap &changes, const QString &zone)
+{
+    onPropertiesChanged(changes, zone);
+    return true;
+}
+
+{% endif %}
 {% if module.tags.config.disablePrivateIF %}
 {%   if interface.tags.config.zoned %}
 /*!
@@ -246,6 +319,11 @@ void {{class}}Private::on{{signal|upperfirst}}({{qtif.join_params(signal)}})
 {%   set configurationId = module.tags.config.configurationId %}
 {% else %}
 {%   set configurationId = module.name %}
+{% endif %}
+{% if not module.tags.config.disablePrivateIF %}
+{%   for property in interface.properties if property.tags.config and property.tags.config.writePolicy %}
+    {{class}}Private::get(this)->setPropertyWritePolicy(u"{{property}}"_s, QIfPropertyWriteThrottle::policyFromString(u"{{property.tags.config.writePolicy}}"_s), {{property.tags.config.writeInterval | default(100)}});
+{%   endfor %}
 {% endif %}
     setConfigurationId(u"{{configurationId}}"_s);
 }
@@ -306,12 +384,32 @@ void {{class}}::registerQmlTypes(const QString& uri, int majorVersion, int minor
 {
     auto d = {{class}}Private::get(this);
     bool forceUpdate = false;
+{%     if module.tags.config.disablePrivateIF %}
     if (!forceUpdate && d->m_{{property}} == {{property}})
         return;
-    if ({{class}}BackendInterface *backend = {{interface|lower}}Backend())
+{%     else %}
+    if (!forceUpdate && d->m_{{property}} == {{property}}) {
+        // A different value might still wait to be written, which needs to be replaced by this one
+        if (Q_LIKELY(!d->m_writeThrottle) || !d->m_writeThrottle->isPending(u"{{property}}"_s))
+            return;
+    }
+{%     endif %}
+    if ({{class}}BackendInterface *backend = {{interface|lower}}Backend()) {
+{%     if module.tags.config.disablePrivateIF %}
         backend->{{property|setter_name}}({{property}}{% if interface.tags.config.zoned %}, zone(){% endif %});
-    else
+{%     else %}
+        if (Q_UNLIKELY(d->m_writeThrottle)) {
+            d->m_writeThrottle->write(u"{{property}}"_s, [this, {{property}}]() {
+                if ({{class}}BackendInterface *backend = {{interface|lower}}Backend())
+                    backend->{{property|setter_name}}({{property}}{% if interface.tags.config.zoned %}, zone(){% endif %});
+            });
+        } else {
+            backend->{{property|setter_name}}({{property}}{% if interface.tags.config.zoned %}, zone(){% endif %});
+        }
+{%     endif %}
+    } else {
         Q_EMIT {{property}}Changed(d->m_{{property}});
+    }
 }
 {%   endif %}
 
@@ -365,9 +463,7 @@ QIfAbstractZonedFeature *{{class}}::createZoneFeature(const QString &zone)
 /*! \internal */
 void {{class}}::connectToServiceObject(QIfServiceObject *serviceObject)
 {
-{% if interface.properties or interface.signals %}
     auto d = {{class}}Private::get(this);
-{% endif %}
 
     auto *backend = {{interface|lower}}Backend();
     if (!backend)
@@ -385,6 +481,13 @@ void {{class}}::connectToServiceObject(QIfServiceObject *serviceObject)
     {{Connect}}(backend, &{{class}}BackendInterface::{{signal}},
         d, &{{class}}Private::on{{signal|upperfirst}});
 {% endfor %}
+{% if module.tags.config.disablePrivateIF %}
+    QObject::connect(backend, &QIfFeatureInterface::propertiesChanged,
+        d, &{{class}}Private::onPropertiesChanged);
+{% else %}
+    QObjectPrivate::connect(backend, &QIfFeatureInterface::propertiesChanged,
+        d, &{{class}}Private::onPropertiesChanged);
+{% endif %}
 
 {% if interface.tags.config.zoned %}
     QIfAbstractZonedFeature::connectToServiceObject(serviceObject);
@@ -70,6 +70,10 @@ public:
 {% for signal in interface.signals %}
     void on{{signal|upperfirst}}({{qtif.join_params(signal, zoned = interface.tags.config.zoned)}});
 {% endfor %}
+    void onPropertiesChanged(const QVariantMap &changes, const QString &zone);
+{% if not module.tags.config.disablePrivateIF %}
+    bool applyPropertyChanges(const QVariantMap &changes, const QString &zone) override;
+{% endif %}
 
 {% if not module.tags.config.disablePrivateIF %}
     {{class}} * const q_ptr;
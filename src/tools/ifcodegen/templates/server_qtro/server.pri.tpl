@@ -8,7 +8,8 @@
 
 QT += interfaceframework remoteobjects ifremoteobjects_helper
 
-HEADERS += $$PWD/core.h
+HEADERS += $$PWD/core.h \
+    $$PWD/zonesnapshot.h
 
 SOURCES += $$PWD/core.cpp
 {% if module.tags.config_server_qtro and module.tags.config_server_qtro.useGeneratedMain %}
@@ -16,6 +16,7 @@ qt6_set_ifcodegen_variable(${VAR_PREFIX}_SOURCES
     ${CMAKE_CURRENT_LIST_DIR}/{{interface|lower}}adapter.cpp
 {% endfor %}
     ${CMAKE_CURRENT_LIST_DIR}/core.h
+    ${CMAKE_CURRENT_LIST_DIR}/zonesnapshot.h
     ${CMAKE_CURRENT_LIST_DIR}/core.cpp
     ${CMAKE_CURRENT_LIST_DIR}/main.cpp
 )
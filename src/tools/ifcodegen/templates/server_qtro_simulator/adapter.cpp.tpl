@@ -35,6 +35,9 @@ using namespace Qt::StringLiterals;
     , m_remoteObjectsLookupName(remoteObjectsLookupName)
     , m_backend(parent)
     , m_helper(this, qLcRO{{interface}}())
+{% if interface_zoned %}
+    , m_zoneSnapshot(new {{interface}}ZoneSnapshotProvider(this))
+{% endif %}
 {
 {% for property in interface.properties %}
 {%   if not property.type.is_model %}
@@ -44,6 +47,26 @@ using namespace Qt::StringLiterals;
 {% for signal in interface.signals %}
     connect(m_backend, &{{interface}}Backend::{{signal}}, this, &{{class}}::{{signal}});
 {% endfor %}
+{% if interface_zoned %}
+    // Single changes are only recorded by the backend and synced by the change signals above.
+    // Non-zoned interfaces don't need the change sets, QtRO syncs their properties itself.
+    connect(m_backend, &QIfFeatureInterface::propertiesChanged, this, [this](const QVariantMap &changes, const QString &zone) {
+{% set vars = { 'variants': False } %}
+{% for property in interface.properties if property.type.is_var %}
+{%   if vars.update({ 'variants': True}) %}{% endif %}
+{% endfor %}
+{% if vars.variants %}
+        QVariantMap remoteChanges = changes;
+{%   for property in interface.properties if property.type.is_var %}
+        if (auto it = remoteChanges.find(u"{{property}}"_s); it != remoteChanges.end())
+            *it = m_helper.toRemoteObjectVariant(*it);
+{%   endfor %}
+        Q_EMIT propertiesChanged(remoteChanges, zone);
+{% else %}
+        Q_EMIT propertiesChanged(changes, zone);
+{% endif %}
+    });
+{% endif %}
 }
 
 QString {{class}}::remoteObjectsLookupName() const
@@ -54,12 +77,15 @@ QString {{class}}::remoteObjectsLookupName() const
 void {{class}}::enableRemoting(QRemoteObjectHostBase *node)
 {
     node->enableRemoting<{{interface}}AddressWrapper>(this);
+{% if interface_zoned %}
+    node->enableRemoting(m_zoneSnapshot, {{interface}}ZoneSnapshotProvider::remoteObjectsLookupName(m_remoteObjectsLookupName));
+{% endif %}
 {% set vars = { 'models': False } %}
 {% for property in interface.properties %}
 {%   if property.type.is_model %}
 {%     if vars.update({ 'models': True}) %}{% endif %}
     auto {{property|lowerfirst}}Adapter = new QIfPagingModelQtRoAdapter(u"{{interface.qualified_name}}.{{property}}"_s, m_backend->{{property|getter_name}}());
-    node->enableRemoting<QIfPagingModelAddressWrapper>({{property|lowerfirst}}Adapter);
+    {{property|lowerfirst}}Adapter->enableRemoting(node);
     m_modelAdapters.insert(node, {{property|lowerfirst}}Adapter);
 {%   endif %}
 {% endfor %}
@@ -70,7 +96,7 @@ void {{class}}::enableRemoting(QRemoteObjectHostBase *node)
 {%   for property in interface.properties %}
 {%     if property.type.is_model %}
         auto {{property|lowerfirst}}Adapter = new QIfPagingModelQtRoAdapter(u"{{interface.qualified_name}}.{{property}}."_s + zone, m_backend->zoneAt(zone)->{{property|getter_name}}());
-        node->enableRemoting<QIfPagingModelAddressWrapper>({{property|lowerfirst}}Adapter);
+        {{property|lowerfirst}}Adapter->enableRemoting(node);
         m_modelAdapters.insert(node, {{property|lowerfirst}}Adapter);
 {%     endif %}
 {%   endfor %}
@@ -81,9 +107,12 @@ void {{class}}::enableRemoting(QRemoteObjectHostBase *node)
 void {{class}}::disableRemoting(QRemoteObjectHostBase *node)
 {
     node->disableRemoting(this);
+{% if interface_zoned %}
+    node->disableRemoting(m_zoneSnapshot);
+{% endif %}
     const auto adapterList = m_modelAdapters.values(node);
     for (QIfPagingModelQtRoAdapter *adapter : adapterList) {
-        node->disableRemoting(adapter);
+        adapter->disableRemoting();
         delete adapter;
     }
     m_modelAdapters.remove(node);
@@ -16,6 +16,9 @@
 
 #include "{{interface|lower}}backend.h"
 #include "rep_{{interface|lower}}_source.h"
+{% if interface_zoned %}
+#include "zonesnapshot.h"
+{% endif %}
 
 QT_FORWARD_DECLARE_CLASS(QIfPagingModelQtRoAdapter)
 
@@ -47,6 +50,7 @@ public:
 
 {% if interface_zoned %}
     Q_INVOKABLE QStringList availableZones() override;
+    bool zoneSnapshotAvailable() const override { return true; }
 {% endif %}
 
 {% for property in interface.properties %}
@@ -81,6 +85,9 @@ private:
     {{interface}}Backend *m_backend;
     QMultiHash<QRemoteObjectHostBase *, QIfPagingModelQtRoAdapter *> m_modelAdapters;
     QIfRemoteObjectsSourceHelper<{{class}}> m_helper;
+{% if interface_zoned %}
+    {{interface}}ZoneSnapshotProvider *m_zoneSnapshot;
+{% endif %}
 };
 
 {{ module|end_namespace }}
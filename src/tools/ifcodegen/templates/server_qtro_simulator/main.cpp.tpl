@@ -15,6 +15,8 @@
 {% endfor %}
 
 #include <QtIfRemoteObjectsHelper/QIfRemoteObjectsConfig>
+#include <QtIfRemoteObjectsHelper/private/qifremoteobjectslazyhost_p.h>
+#include <QtInterfaceFramework/QIfConfiguration>
 #include <QtInterfaceFramework/QIfSimulationEngine>
 
 using namespace Qt::StringLiterals;
@@ -37,6 +39,21 @@ int main(int argc, char *argv[])
     bool gui = true;
 {% else %}
 {{   error("Unknown value in 'config_simulator.defaultServerMode'. Valid modes are: 'headless', 'gui'")}}
+{% endif %}
+{% if module.tags.config_simulator and module.tags.config_simulator.defaultLoadingMode %}
+{%   set defaultLoadingMode = module.tags.config_simulator.defaultLoadingMode %}
+{% else %}
+{%   set defaultLoadingMode = "eager" %}
+{% endif %}
+{% if defaultLoadingMode == "eager" %}
+    bool lazy = false;
+{% elif defaultLoadingMode == "lazy" %}
+{%   if module.tags.config_simulator.simulationFile %}
+{{     error("'config_simulator.defaultLoadingMode' can't be 'lazy' when a 'config_simulator.simulationFile' is set")}}
+{%   endif %}
+    bool lazy = true;
+{% else %}
+{{   error("Unknown value in 'config_simulator.defaultLoadingMode'. Valid modes are: 'eager', 'lazy'")}}
 {% endif %}
     bool guiOptionSet = false;
     bool headlessOptionSet = false;
@@ -70,6 +87,13 @@ int main(int argc, char *argv[])
                                                       "in the simulation code"_s);
     parser.addOption(headlessOption);
 
+    QCommandLineOption lazyOption(u"lazy"_s, u"Lazy mode. The backends and simulation QML of all interfaces "
+                                              "sharing a url are only loaded once a replica connects to it"_s);
+    parser.addOption(lazyOption);
+    QCommandLineOption eagerOption(u"eager"_s, u"Eager mode. All backends are loaded and initialized "
+                                                "at startup"_s);
+    parser.addOption(eagerOption);
+
     QCommandLineOption serverUrlOption(u"serverUrl"_s, u"The serverUrl to use for all Remote Objects hosted in this server"_s, u"url"_s);
     parser.addOption(serverUrlOption);
 
@@ -78,6 +102,19 @@ int main(int argc, char *argv[])
 
     parser.process(qApp->arguments());
 
+    if (parser.isSet(lazyOption) && parser.isSet(eagerOption))
+        qFatal("--lazy and --eager can't be used at the same time!");
+    if (parser.isSet(lazyOption))
+        lazy = true;
+    else if (parser.isSet(eagerOption))
+        lazy = false;
+{% if module.tags.config_simulator and module.tags.config_simulator.simulationFile %}
+    if (lazy) {
+        qWarning("The lazy mode can't be used together with a custom simulation file. Falling back to the eager mode.");
+        lazy = false;
+    }
+{% endif %}
+
     // single instance guard
     QLockFile lockFile(u"%1/%2.lock"_s.arg(QDir::tempPath(), qApp->applicationName()));
     if (!lockFile.tryLock(100)) {
@@ -94,6 +131,71 @@ int main(int argc, char *argv[])
         config.parseLegacyConfigFile();
 
     auto simulationEngine = new QIfSimulationEngine(u"{{module.name|lower}}"_s);
+    simulationEngine->loadSimulationData(u":/simulation/{{module.module_name|lower}}_simulation_data.cbor"_s);
+
+    if (lazy) {
+        //Register the types for the SimulationEngine
+        {{module.module_name|upperfirst}}::registerQmlTypes(u"{{module|qml_type}}.simulation"_s, {{module.majorVersion}}, {{module.minorVersion}});
+
+        // A simulation override replaces the simulation of the whole module and needs all backends
+        // to be registered before it is loaded. In this case all backends are created together,
+        // once the first replica connects.
+        const bool simulationOverride = QIfConfiguration::isSimulationFileSet(u"{{module.name|lower}}"_s);
+        if (simulationOverride)
+            qInfo("A simulation override is set. All backends are created once the first replica connects.");
+
+{% for interface in module.interfaces %}
+        {{interface}}Backend *{{interface|lowerfirst}}Instance = nullptr;
+{% endfor %}
+        auto createBackend = [&](const QString &interface) {
+{% for interface in module.interfaces %}
+            if (!{{interface|lowerfirst}}Instance && (simulationOverride || interface == u"{{interface}}"_s)) {
+                {{interface|lowerfirst}}Instance = new {{interface}}Backend(simulationEngine);
+                simulationEngine->registerSimulationInstance({{interface|lowerfirst}}Instance, "{{module|qml_type}}.simulation", {{module.majorVersion}}, {{module.minorVersion}}, "{{interface}}Backend");
+                if (!simulationOverride)
+                    simulationEngine->loadSimulation(QUrl(u"qrc:///simulation/{{interface|upperfirst}}Simulation.qml"_s));
+            }
+{% endfor %}
+            // loadSimulation() replaces the module simulation by the override
+            if (simulationOverride)
+                simulationEngine->loadSimulation(QUrl(u"qrc:///simulation/{{module.module_name|lower}}_simulation.qml"_s));
+
+            //initialize the created backends
+{% for interface in module.interfaces %}
+            if (simulationOverride || interface == u"{{interface}}"_s) {
+                {{interface|lowerfirst}}Instance->initialize();
+{%   for property in interface.properties %}
+{%     if property.type.is_model %}
+                {{interface|lowerfirst}}Instance->{{property|getter_name}}()->initialize();
+{%     endif %}
+{%   endfor %}
+            }
+{% endfor %}
+        };
+
+        //Start listening, the backends are created and remoted once the first replica connects
+        QHash<QUrl, QIfRemoteObjectsLazyHost *> lazyHosts;
+{% for interface in module.interfaces %}
+        {
+            const QUrl url = config.url(u"{{module}}"_s, u"{{interface}}"_s);
+            QIfRemoteObjectsLazyHost *lazyHost = lazyHosts.value(url);
+            if (!lazyHost) {
+                lazyHost = new QIfRemoteObjectsLazyHost(url, simulationEngine);
+                if (!lazyHost->listen())
+                    qFatal("Couldn't listen on %s: %s", qPrintable(url.toString()), qPrintable(lazyHost->errorString()));
+                lazyHosts.insert(url, lazyHost);
+            }
+            lazyHost->addSourceFactory([&](QRemoteObjectHostBase *node) {
+                if (!{{interface|lowerfirst}}Instance)
+                    createBackend(u"{{interface}}"_s);
+                auto {{interface|lowerfirst}}Adapter = new {{interface}}QtRoAdapter({{interface|lowerfirst}}Instance);
+                {{interface|lowerfirst}}Adapter->enableRemoting(node);
+            });
+        }
+{% endfor %}
+
+        return qApp->exec();
+    }
 
 {% for interface in module.interfaces %}
     auto {{interface|lowerfirst}}Instance = new {{interface}}Backend(simulationEngine);
@@ -106,7 +208,6 @@ int main(int argc, char *argv[])
 {% else %}
 {%   set simulationFile = "qrc:///simulation/" + module.module_name|lower + '_simulation.qml' %}
 {% endif %}
-    simulationEngine->loadSimulationData(u":/simulation/{{module.module_name|lower}}_simulation_data.json"_s);
     simulationEngine->loadSimulation(QUrl(u"{{simulationFile}}"_s));
 
     //initialize all our backends
@@ -12,7 +12,8 @@ HEADERS += \
     $$PWD/{{interface|lower}}backend.h \
     $$PWD/{{interface|lower}}adapter.h \
 {% endfor %}
-    $$PWD/core.h
+    $$PWD/core.h \
+    $$PWD/zonesnapshot.h
 
 SOURCES += \
 {% for interface in module.interfaces %}
@@ -31,4 +32,5 @@ RESOURCES += $$PWD/{{module.module_name|lower}}_simulation.qrc
 
 OTHER_FILES += \
     $$PWD/{{module.module_name|lower}}.json \
-    $$PWD/{{module.module_name|lower}}_simulation_data.json
+    $$PWD/{{module.module_name|lower}}_simulation_data.json \
+    $$PWD/{{module.module_name|lower}}_simulation_data.cbor
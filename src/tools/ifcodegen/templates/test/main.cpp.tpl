@@ -5,7 +5,7 @@
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 #}
 {% include "common/generated_comment.cpp.tpl" %}
-{% set testCases = ["InitBackend", "WithoutBackend", "InvalidBackend", "ClearServiceObject", "ChangeFromBackend", "ChangeFromFrontend", "Methods", "Signals", "Models"] %}
+{% set testCases = ["InitBackend", "WithoutBackend", "InvalidBackend", "ClearServiceObject", "ChangeFromBackend", "BatchedChangeFromBackend", "ChangeFromFrontend", "Methods", "Signals", "Models"] %}
 #include <QtTest>
 {% for interface in module.interfaces %}
 #include "tst_{{interface|lower}}.h"
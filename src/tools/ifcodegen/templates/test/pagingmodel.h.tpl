@@ -5,6 +5,7 @@
 # Copyright (C) 2017 Klaralvdalens Datakonsult AB (KDAB).
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 #}
+{% import 'common/qtif_macros.j2' as qtif %}
 {% set interface_zoned = interface.tags.config and interface.tags.config.zoned  %}
 {% if interface_zoned %}
 {% set class = 'Zoned{0}Model'.format(property|upperfirst) %}
@@ -12,7 +13,7 @@
 {% set class = '{0}Model'.format(property|upperfirst) %}
 {% endif %}
 
-#include "{{property.type.nested|lower}}.h"
+{{ qtif.struct_include(property.type.nested.reference, module) }}
 #include <QtDebug>
 
 #include <QIfPagingModelInterface>
@@ -15,6 +15,7 @@
 {% endfor %}
 #include "tst_{{interface|lower}}.h"
 
+#include <QtInterfaceFramework/QIfConfiguration>
 #include <QtInterfaceFramework/QIfServiceManager>
 #include <QtInterfaceFramework/QIfServiceObject>
 
@@ -390,6 +391,36 @@ void {{interface}}Test::testChangeFromBackend()
 {% endfor %}
 }
 
+void {{interface}}Test::testBatchedChangeFromBackend()
+{
+    {{interface}}TestServiceObject *service = new {{interface}}TestServiceObject();
+    manager->registerService(service, service->interfaces());
+
+    {{interface}} cc;
+    cc.startAutoDiscovery();
+
+    auto backend = service->testBackend();
+    backend->beginPropertyUpdate();
+{% for property in interface.properties %}
+{%   if not property.type.is_model %}
+    QSignalSpy {{property}}Spy(&cc, SIGNAL({{property}}Changed({{property|return_type}})));
+    {{property|parameter_type}}TestValue = {{property|test_type_value}};
+    backend->updateProperty(u"{{property}}"_s, QVariant::fromValue({{property}}TestValue));
+    QCOMPARE({{property}}Spy.count(), 0);
+    QCOMPARE(cc.{{property|getter_name}}(), {{property|default_type_value}});
+
+{%   endif %}
+{% endfor %}
+    backend->commitPropertyUpdate();
+    QVERIFY(!backend->isPropertyUpdateActive());
+{% for property in interface.properties %}
+{%   if not property.type.is_model %}
+    QCOMPARE({{property}}Spy.count(), 1);
+    QCOMPARE(cc.{{property|getter_name}}(), {{property}}TestValue);
+{%   endif %}
+{% endfor %}
+}
+
 void {{interface}}Test::testChangeFromFrontend()
 {
     {{interface}}TestServiceObject *service = new {{interface}}TestServiceObject();
@@ -413,6 +444,82 @@ void {{interface}}Test::testChangeFromFrontend()
 {% endfor %}
 }
 
+void {{interface}}Test::testWritePolicies()
+{
+{% if module.tags.config.disablePrivateIF %}
+    QSKIP("Write policies are not supported if the private interface is disabled");
+{% else %}
+{%   if interface.tags.config.configurationId %}
+{%     set configurationId = interface.tags.config.configurationId %}
+{%   elif module.tags.config.configurationId %}
+{%     set configurationId = module.tags.config.configurationId %}
+{%   else %}
+{%     set configurationId = module.name %}
+{%   endif %}
+    {{interface}}TestServiceObject *service = new {{interface}}TestServiceObject();
+    manager->registerService(service, service->interfaces());
+
+    auto writePolicies = [](const QString &policy) {
+        QVariantMap policies;
+{%   for property in interface.properties if not property.readonly and not property.const and not property.type.is_model %}
+        policies.insert(u"{{property}}"_s, QVariantMap({ { u"policy"_s, policy }, { u"interval"_s, 50 } }));
+{%   endfor %}
+        return policies;
+    };
+
+    // Coalesce: The first write is forwarded right away, all following writes are merged
+    QVERIFY(QIfConfiguration::setPropertyWritePolicies(u"{{configurationId}}"_s, writePolicies(u"coalesce"_s)));
+    {
+        {{interface}} cc;
+        cc.startAutoDiscovery();
+
+{%   for property in interface.properties if not property.readonly and not property.const and not property.type.is_model %}
+        //Test {{property}}
+        QSignalSpy {{property}}Spy(&cc, SIGNAL({{property}}Changed({{property|return_type}})));
+        {{property|parameter_type}}TestValue = {{property|test_type_value}};
+        cc.{{property|setter_name}}({{property}}TestValue);
+        QCOMPARE({{property}}Spy.count(), 1);
+        QCOMPARE(cc.{{property|getter_name}}(), {{property}}TestValue);
+        // The latest value needs to win, even if it matches the current value
+        cc.{{property|setter_name}}({{property|default_type_value}});
+        cc.{{property|setter_name}}({{property}}TestValue);
+
+{%   endfor %}
+        QTest::qWait(150);
+{%   for property in interface.properties if not property.readonly and not property.const and not property.type.is_model %}
+        QCOMPARE({{property}}Spy.count(), 1);
+        QCOMPARE(cc.{{property|getter_name}}(), {{property}}TestValue);
+{%   endfor %}
+    }
+
+    // CommitOnIdle: Only the latest value is forwarded, once no new value was written
+    QVERIFY(QIfConfiguration::setPropertyWritePolicies(u"{{configurationId}}"_s, writePolicies(u"commitOnIdle"_s)));
+    {
+        {{interface}} cc;
+        cc.startAutoDiscovery();
+
+{%   for property in interface.properties if not property.readonly and not property.const and not property.type.is_model %}
+        //Test {{property}}
+        QSignalSpy {{property}}Spy(&cc, SIGNAL({{property}}Changed({{property|return_type}})));
+        {{property|parameter_type}}TestValue = {{property|test_type_value}};
+        QCOMPARE(cc.{{property|getter_name}}(), {{property}}TestValue);
+        cc.{{property|setter_name}}({{property|default_type_value}});
+        QCOMPARE({{property}}Spy.count(), 0);
+        // Writing the current value again replaces the pending write
+        cc.{{property|setter_name}}({{property}}TestValue);
+
+{%   endfor %}
+        QTest::qWait(150);
+{%   for property in interface.properties if not property.readonly and not property.const and not property.type.is_model %}
+        QCOMPARE({{property}}Spy.count(), 0);
+        QCOMPARE(cc.{{property|getter_name}}(), {{property}}TestValue);
+{%   endfor %}
+    }
+
+    QVERIFY(QIfConfiguration::setPropertyWritePolicies(u"{{configurationId}}"_s, writePolicies(u"immediate"_s)));
+{% endif %}
+}
+
 void {{interface}}Test::testMethods()
 {
     {{interface}}TestServiceObject *service = new {{interface}}TestServiceObject();
@@ -482,7 +589,7 @@ void {{interface}}Test::testModels()
     QVERIFY({{property}}->serviceObject());
 
     QVERIFY({{property}}->rowCount());
-    QCOMPARE({{property}}->at<{{property.type.nested}}>(0), {{property.type.nested|test_type_value}});
+    QCOMPARE({{property}}->at<{{property.type.nested.reference|add_namespace_prefix}}>(0), {{property.type.nested|test_type_value}});
 {%      endif %}
 {%   endfor %}
 }
@@ -27,7 +27,9 @@ public Q_SLOTS:
     void testInvalidBackend();
     void testClearServiceObject();
     void testChangeFromBackend();
+    void testBatchedChangeFromBackend();
     void testChangeFromFrontend();
+    void testWritePolicies();
     void testMethods();
     void testSignals();
     void testModels();
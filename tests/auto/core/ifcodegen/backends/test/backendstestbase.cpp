@@ -8,6 +8,7 @@
 #include "echozoned.h"
 
 #include <QIfServiceManager>
+#include <QIfServiceObject>
 #include <QIfConfiguration>
 
 static QString frontLeftZone = QStringLiteral("FrontLeft");
@@ -58,7 +59,7 @@ void BackendsTestBase::startServer(QStringList arguments)
     if (!m_serverExecutable.isEmpty()) {
         qInfo() << "Starting Server Process";
         QVERIFY2(QFile::exists(m_serverExecutable), qPrintable(u"Executable doesn't exist: %1"_s.arg(m_serverExecutable)));
-        m_serverProcess->start(m_serverExecutable, arguments);
+        m_serverProcess->start(m_serverExecutable, m_serverArguments + arguments);
         QVERIFY2(m_serverProcess->waitForStarted(), qPrintable(u"Process error: %1"_s.arg(m_serverProcess->error())));
     }
 #endif
@@ -109,6 +110,7 @@ void BackendsTestBase::initTestCase_data()
     QTest::addColumn<bool>("isSimulation");
     QTest::addColumn<bool>("asyncBackendLoading");
     QTest::addColumn<QString>("serverExecutable");
+    QTest::addColumn<QStringList>("serverArguments");
 }
 
 void BackendsTestBase::initTestCase()
@@ -125,8 +127,10 @@ void BackendsTestBase::init()
     QFETCH_GLOBAL(bool, isSimulation);
     QFETCH_GLOBAL(bool, asyncBackendLoading);
     QFETCH_GLOBAL(QString, serverExecutable);
+    QFETCH_GLOBAL(QStringList, serverArguments);
 
     m_serverExecutable = serverExecutable;
+    m_serverArguments = serverArguments;
     m_isSimulation = isSimulation;
     m_asyncBackendLoading = asyncBackendLoading;
     m_isSimulationBackend = isSimulation && serverExecutable.isEmpty();
@@ -732,6 +736,93 @@ void BackendsTestBase::testZonedServer2Client()
     QCOMPARE(testEnumSpy[0][0].value<Echomodule::TestEnum>(), testEnumTestValue);
 }
 
+void BackendsTestBase::testResumeBackendUpdates()
+{
+    Echo client;
+    client.setAsynchronousBackendLoading(m_asyncBackendLoading);
+    QSignalSpy serviceObjectChangedSpy(&client, &Echo::serviceObjectChanged);
+    QSignalSpy initSpy(&client, SIGNAL(isInitializedChanged(bool)));
+    QVERIFY(initSpy.isValid());
+    client.startAutoDiscovery();
+    WAIT_AND_COMPARE(serviceObjectChangedSpy, 1);
+
+    startServer();
+
+    //wait until the client has connected and initial values are set
+    WAIT_AND_COMPARE(initSpy, 1);
+    QVERIFY(client.isInitialized());
+
+    QIfFeatureInterface *backend = client.serviceObject()->interfaceInstance(client.interfaceName());
+    QVERIFY(backend);
+    QVERIFY(backend->isPropertyStateTrackingEnabled());
+
+    //change a value using a second client while the updates of the first one are paused
+    Echo client2;
+    QSignalSpy initSpy2(&client2, SIGNAL(isInitializedChanged(bool)));
+    QVERIFY(initSpy2.isValid());
+    client2.startAutoDiscovery();
+    WAIT_AND_COMPARE(initSpy2, 1);
+
+    client.setBackendUpdatesEnabled(false);
+
+    QSignalSpy intValueSpy(&client, SIGNAL(intValueChanged(int)));
+    QVERIFY(intValueSpy.isValid());
+    QSignalSpy intValueSpy2(&client2, SIGNAL(intValueChanged(int)));
+    QVERIFY(intValueSpy2.isValid());
+    int intValueTestValue = 54321;
+    client2.setIntValue(intValueTestValue);
+    WAIT_AND_COMPARE(intValueSpy2, 1);
+    QCOMPARE(intValueSpy.count(), 0);
+
+    //resuming only applies the recorded changes, the backend is not initialized again
+    QSignalSpy backendInitSpy(backend, &QIfFeatureInterface::initializationDone);
+    QVERIFY(backendInitSpy.isValid());
+    client.setBackendUpdatesEnabled(true);
+    WAIT_AND_COMPARE(intValueSpy, 1);
+    QCOMPARE(client.intValue(), intValueTestValue);
+    QCOMPARE(backendInitSpy.count(), 0);
+}
+
+void BackendsTestBase::testSinglePropertyDispatch()
+{
+    Echo client;
+    client.setAsynchronousBackendLoading(m_asyncBackendLoading);
+    QSignalSpy serviceObjectChangedSpy(&client, &Echo::serviceObjectChanged);
+    QSignalSpy initSpy(&client, SIGNAL(isInitializedChanged(bool)));
+    QVERIFY(initSpy.isValid());
+    client.startAutoDiscovery();
+    WAIT_AND_COMPARE(serviceObjectChangedSpy, 1);
+
+    startServer();
+
+    //wait until the client has connected and initial values are set
+    WAIT_AND_COMPARE(initSpy, 1);
+    QVERIFY(client.isInitialized());
+
+    QIfFeatureInterface *backend = client.serviceObject()->interfaceInstance(client.interfaceName());
+    QVERIFY(backend);
+    const quint64 version = backend->propertyStateVersion();
+
+    //a single setter is only reported by the change signal of the property, not as a change set
+    QSignalSpy backendIntValueSpy(backend, SIGNAL(intValueChanged(int)));
+    QVERIFY(backendIntValueSpy.isValid());
+    QSignalSpy propertiesChangedSpy(backend, &QIfFeatureInterface::propertiesChanged);
+    QVERIFY(propertiesChangedSpy.isValid());
+    QSignalSpy intValueSpy(&client, SIGNAL(intValueChanged(int)));
+    QVERIFY(intValueSpy.isValid());
+    int intValueTestValue = 24680;
+    client.setIntValue(intValueTestValue);
+    WAIT_AND_COMPARE(intValueSpy, 1);
+    QCOMPARE(client.intValue(), intValueTestValue);
+    QCOMPARE(backendIntValueSpy.count(), 1);
+    QCOMPARE(propertiesChangedSpy.count(), 0);
+
+    //but the change is still recorded for resuming features
+    QHash<QString, QVariantMap> changes;
+    QVERIFY(backend->propertyChangesSince(version, &changes));
+    QCOMPARE(changes.value(QString()).value(u"intValue"_s).toInt(), intValueTestValue);
+}
+
 void BackendsTestBase::testSlots()
 {
     Echo client;
@@ -48,6 +48,8 @@ private slots:
     void testZonedClient2Server();
     void testServer2Client();
     void testZonedServer2Client();
+    void testResumeBackendUpdates();
+    void testSinglePropertyDispatch();
     void testSlots();
     void testZonedSlots();
     void testMultipleSlotCalls();
@@ -66,6 +68,7 @@ protected:
     bool m_asyncBackendLoading;
     bool m_isSimulationBackend;
     QString m_serverExecutable;
+    QStringList m_serverArguments;
 };
 
 #endif // BACKENDSTESTBASE_H
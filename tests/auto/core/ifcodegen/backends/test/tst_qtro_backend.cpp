@@ -17,16 +17,20 @@ private slots:
         BackendsTestBase::initTestCase_data();
         QDir currentDir = QDir::current();
 
-        QTest::newRow("qtro-static-backend") << "org.example.echomodule_qtro_static" << false << false << currentDir.absoluteFilePath(u"org-example-echo-qtro-server"_s + exeSuffix);
-        QTest::newRow("qtro-server") << "echo_backend_qtro" << false << false << currentDir.absoluteFilePath(u"org-example-echo-qtro-server"_s + exeSuffix);
-        QTest::newRow("qtro-server asyncBackendLoading") << "echo_backend_qtro" << false << true << currentDir.absoluteFilePath(u"org-example-echo-qtro-server"_s + exeSuffix);
-        QTest::newRow("qtro-simulation-server") << "echo_backend_qtro" << true << false << currentDir.absoluteFilePath(u"org-example-echo-qtro-simulation-server"_s + exeSuffix);
+        QTest::newRow("qtro-static-backend") << "org.example.echomodule_qtro_static" << false << false << currentDir.absoluteFilePath(u"org-example-echo-qtro-server"_s + exeSuffix) << QStringList();
+        QTest::newRow("qtro-server") << "echo_backend_qtro" << false << false << currentDir.absoluteFilePath(u"org-example-echo-qtro-server"_s + exeSuffix) << QStringList();
+        QTest::newRow("qtro-server asyncBackendLoading") << "echo_backend_qtro" << false << true << currentDir.absoluteFilePath(u"org-example-echo-qtro-server"_s + exeSuffix) << QStringList();
+        QTest::newRow("qtro-simulation-server") << "echo_backend_qtro" << true << false << currentDir.absoluteFilePath(u"org-example-echo-qtro-simulation-server"_s + exeSuffix) << QStringList();
+        QTest::newRow("qtro-simulation-server lazy") << "echo_backend_qtro" << true << false << currentDir.absoluteFilePath(u"org-example-echo-qtro-simulation-server"_s + exeSuffix) << QStringList({u"--lazy"_s});
     }
 
     void testRemoteObjectsConfig()
     {
         if (m_isSimulationBackend)
             QSKIP("This test is only for remoteobject");
+        // The simulation is only loaded once a replica connects to the changed url
+        if (m_serverArguments.contains(u"--lazy"_s))
+            QSKIP("This test doesn't work with the lazy mode");
 
         Echo client;
         QSignalSpy initSpy(&client, SIGNAL(isInitializedChanged(bool)));
@@ -72,6 +76,67 @@ private slots:
         WAIT_AND_COMPARE(zonedInitSpy, 1);
         QVERIFY(zonedClient.isInitialized());
     }
+
+    void testLazyLoading()
+    {
+#if QT_CONFIG(process)
+        if (!m_isSimulation)
+            QSKIP("This test is only for the simulation server");
+
+        auto resetEnvironment = qScopeGuard([this]() {
+            m_serverProcess->setProcessEnvironment(QProcessEnvironment(QProcessEnvironment::InheritFromParent));
+        });
+
+        // Without an override every interface loads its own simulation once a replica connects
+        QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+        environment.remove(u"QTIF_SIMULATION_OVERRIDE"_s);
+        m_serverProcess->setProcessEnvironment(environment);
+
+        Echo client;
+        QSignalSpy initSpy(&client, SIGNAL(isInitializedChanged(bool)));
+        QVERIFY(initSpy.isValid());
+        QVERIFY(client.startAutoDiscovery() > QIfAbstractFeature::ErrorWhileLoading);
+
+        m_serverProcess->start(m_serverExecutable, {u"--lazy"_s});
+        QVERIFY2(m_serverProcess->waitForStarted(), qPrintable(u"Process error: %1"_s.arg(m_serverProcess->error())));
+
+        //wait until the client has connected and the values of the simulation data are set
+        WAIT_AND_COMPARE(initSpy, 1);
+        QVERIFY(client.isInitialized());
+        QCOMPARE(client.weekDay(), Echomodule::Wednesday);
+
+        EchoZoned zonedClient;
+        QSignalSpy zonedInitSpy(&zonedClient, SIGNAL(isInitializedChanged(bool)));
+        QVERIFY(zonedInitSpy.isValid());
+        zonedClient.setServiceObject(client.serviceObject());
+        WAIT_AND_COMPARE(zonedInitSpy, 1);
+        QVERIFY(zonedClient.isInitialized());
+        QCOMPARE(zonedClient.availableZones(), QStringList({u"FrontLeft"_s}));
+
+        cleanupTestData();
+        QVERIFY(!client.isInitialized());
+        initSpy.clear();
+
+        // The override contains the simulation of the whole module and needs to be loaded as well
+        m_serverProcess->setProcessEnvironment(QProcessEnvironment(QProcessEnvironment::InheritFromParent));
+        QVERIFY(client.startAutoDiscovery() > QIfAbstractFeature::ErrorWhileLoading);
+
+        m_serverProcess->start(m_serverExecutable, {u"--lazy"_s});
+        QVERIFY2(m_serverProcess->waitForStarted(), qPrintable(u"Process error: %1"_s.arg(m_serverProcess->error())));
+
+        WAIT_AND_COMPARE(initSpy, 1);
+        QVERIFY(client.isInitialized());
+
+        // The override connects to the command socket once it is loaded
+        if (!m_localServer->hasPendingConnections())
+            QVERIFY(m_localServer->waitForNewConnection(5000));
+        while (m_localServer->hasPendingConnections())
+            m_localSocket = m_localServer->nextPendingConnection();
+        QVERIFY(m_localSocket);
+#else
+        QSKIP("This test needs QProcess support");
+#endif
+    }
 };
 
 QTEST_MAIN(QtRoBackendTest)
@@ -12,11 +12,17 @@
 #include <QIfProxyServiceObject>
 #include <QIfServiceInterface>
 #include <QIfAbstractFeatureListModel>
+#include <QIfAbstractZonedFeature>
+#include <QIfZonedFeatureInterface>
 #include <QIfServiceManager>
 #include <QQmlIncubationController>
 
+#include <private/qifabstractfeature_p.h>
+
 #include "qiffeaturetester.h"
 
+using namespace Qt::StringLiterals;
+
 int acceptCounter = 100;
 
 class PeriodicIncubationController : public QObject,
@@ -207,7 +213,9 @@ public:
 
     void initialize() override
     {
+        m_initializeCount++;
         emit intPropertyChanged(m_intProperty);
+        updateProperty(u"intProperty"_s, m_intProperty);
         emit initializationDone();
     }
 
@@ -224,10 +232,127 @@ public:
         emit intPropertyChanged(m_intProperty);
     }
 
+    // Only reports the change with updateProperty(), which is tracked in the property state
+    void updateIntProperty(int intProperty)
+    {
+        m_intProperty = intProperty;
+        updateProperty(u"intProperty"_s, m_intProperty);
+    }
+
+    int m_initializeCount = 0;
+
 private:
     int m_intProperty = 0;
 };
 
+class ResumableFeature;
+
+class ResumableFeaturePrivate : public QIfAbstractFeaturePrivate
+{
+public:
+    ResumableFeaturePrivate(ResumableFeature *parent);
+
+    bool applyPropertyChanges(const QVariantMap &changes, const QString &zone) override;
+};
+
+// A feature which only uses change sets and is able to apply the changes it missed
+class ResumableFeature : public QIfAbstractFeature
+{
+    Q_OBJECT
+
+public:
+    ResumableFeature(QObject *parent = nullptr)
+        : QIfAbstractFeature(*new ResumableFeaturePrivate(this), parent)
+    {}
+
+    int intProperty() const
+    {
+        return m_intProperty;
+    }
+
+    void connectToServiceObject(QIfServiceObject *serviceObject) override
+    {
+        auto *backend = qobject_cast<QIfFeatureInterface*>(serviceObject->interfaceInstance(interfaceName()));
+        connect(backend, &QIfFeatureInterface::propertiesChanged, this, &ResumableFeature::onPropertiesChanged);
+
+        QIfAbstractFeature::connectToServiceObject(serviceObject);
+    }
+
+    void clearServiceObject() override
+    {
+    }
+
+    void onPropertiesChanged(const QVariantMap &changes, const QString &zone)
+    {
+        Q_UNUSED(zone)
+        m_changeSetCount++;
+        if (changes.contains(u"intProperty"_s))
+            m_intProperty = changes.value(u"intProperty"_s).toInt();
+    }
+
+    int m_changeSetCount = 0;
+
+private:
+    int m_intProperty = 0;
+};
+
+ResumableFeaturePrivate::ResumableFeaturePrivate(ResumableFeature *parent)
+    : QIfAbstractFeaturePrivate(u"testFeature"_s, parent)
+{
+}
+
+bool ResumableFeaturePrivate::applyPropertyChanges(const QVariantMap &changes, const QString &zone)
+{
+    static_cast<ResumableFeature *>(q_ptr)->onPropertiesChanged(changes, zone);
+    return true;
+}
+
+class TestZonedFeatureBackend : public QIfZonedFeatureInterface
+{
+    Q_OBJECT
+
+public:
+    TestZonedFeatureBackend(QObject *parent = nullptr)
+        : QIfZonedFeatureInterface(parent)
+    {}
+
+    void initialize() override
+    {
+        emit availableZonesChanged(m_zones);
+        emit initializationDone();
+    }
+
+    QStringList availableZones() const override
+    {
+        return m_zones;
+    }
+
+    void setZones(const QStringList &zones)
+    {
+        m_zones = zones;
+        emit availableZonesChanged(m_zones);
+    }
+
+private:
+    QStringList m_zones;
+};
+
+class TestZonedFeature : public QIfAbstractZonedFeature
+{
+    Q_OBJECT
+
+public:
+    TestZonedFeature(const QString &zone = QString(), QObject *parent = nullptr)
+        : QIfAbstractZonedFeature(u"testZonedFeature"_s, zone, parent)
+    {}
+
+protected:
+    QIfAbstractZonedFeature *createZoneFeature(const QString &zone) override
+    {
+        return new TestZonedFeature(zone, this);
+    }
+};
+
 class TestBackend : public QObject, public QIfServiceInterface
 {
     Q_OBJECT
@@ -287,6 +412,9 @@ private Q_SLOTS:
     void testServiceObjectDestruction();
     void testResetServiceObject();
     void testBackendUpdates();
+    void testBackendUpdatesResume();
+    void testRecordProperty();
+    void testZones();
     void testLoader();
 
 private:
@@ -652,6 +780,163 @@ void BaseTest::testBackendUpdates()
     QCOMPARE(secondFeature->intProperty(), 0);
 }
 
+void BaseTest::testBackendUpdatesResume()
+{
+    if (m_isModel)
+        QSKIP("The property changes are only applied by features");
+
+    TestBackend* backend = new TestBackend();
+    TestFeatureBackend *featureBackend = backend->m_testBackend;
+    featureBackend->setPropertyStateTrackingEnabled(true);
+    m_manager->registerService(backend, backend->interfaces());
+
+    ResumableFeature *f = new ResumableFeature(this);
+    ResumableFeature *otherFeature = new ResumableFeature(this);
+    f->startAutoDiscovery();
+    otherFeature->startAutoDiscovery();
+    QVERIFY(f->isInitialized());
+    QCOMPARE(featureBackend->m_initializeCount, 2);
+
+    featureBackend->updateIntProperty(42);
+    QCOMPARE(f->intProperty(), 42);
+
+    f->setBackendUpdatesEnabled(false);
+    QVERIFY(!f->isInitialized());
+    featureBackend->updateIntProperty(100);
+    QCOMPARE(f->intProperty(), 42);
+    QCOMPARE(otherFeature->intProperty(), 100);
+
+    // Only the missed change is applied, without initializing the backend again or informing
+    // the other feature
+    const int otherChangeSetCount = otherFeature->m_changeSetCount;
+    f->setBackendUpdatesEnabled(true);
+    QVERIFY(f->isInitialized());
+    QCOMPARE(f->intProperty(), 100);
+    QCOMPARE(featureBackend->m_initializeCount, 2);
+    QCOMPARE(otherFeature->m_changeSetCount, otherChangeSetCount);
+
+    // Nothing to apply if nothing changed
+    const int changeSetCount = f->m_changeSetCount;
+    f->setBackendUpdatesEnabled(false);
+    f->setBackendUpdatesEnabled(true);
+    QVERIFY(f->isInitialized());
+    QCOMPARE(f->m_changeSetCount, changeSetCount);
+    QCOMPARE(featureBackend->m_initializeCount, 2);
+
+    // Without the property state the backend needs to be initialized again
+    featureBackend->setPropertyStateTrackingEnabled(false);
+    f->setBackendUpdatesEnabled(false);
+    featureBackend->updateIntProperty(5);
+    f->setBackendUpdatesEnabled(true);
+    QCOMPARE(featureBackend->m_initializeCount, 3);
+    QCOMPARE(f->intProperty(), 5);
+
+    // The same applies if the tracking was enabled after pausing
+    f->setBackendUpdatesEnabled(false);
+    featureBackend->setPropertyStateTrackingEnabled(true);
+    featureBackend->updateIntProperty(6);
+    f->setBackendUpdatesEnabled(true);
+    QCOMPARE(featureBackend->m_initializeCount, 4);
+    QCOMPARE(f->intProperty(), 6);
+}
+
+void BaseTest::testRecordProperty()
+{
+    if (m_isModel)
+        QSKIP("The property changes are only applied by features");
+
+    TestBackend* backend = new TestBackend();
+    TestFeatureBackend *featureBackend = backend->m_testBackend;
+    featureBackend->setPropertyStateTrackingEnabled(true);
+    m_manager->registerService(backend, backend->interfaces());
+
+    ResumableFeature *f = new ResumableFeature(this);
+    f->startAutoDiscovery();
+    QVERIFY(f->isInitialized());
+
+    // A recorded change is not dispatched again, it was already reported by a change signal
+    QSignalSpy propertiesChangedSpy(featureBackend, &QIfFeatureInterface::propertiesChanged);
+    const int changeSetCount = f->m_changeSetCount;
+    const quint64 version = featureBackend->propertyStateVersion();
+    featureBackend->recordProperty(u"intProperty"_s, 42);
+    QCOMPARE(propertiesChangedSpy.count(), 0);
+    QCOMPARE(f->m_changeSetCount, changeSetCount);
+    QCOMPARE(featureBackend->propertyStateVersion(), version + 1);
+
+    QHash<QString, QVariantMap> changes;
+    QVERIFY(featureBackend->propertyChangesSince(version, &changes));
+    QCOMPARE(changes.value(QString()).value(u"intProperty"_s), QVariant(42));
+
+    // Recording doesn't wait for a batched update to be committed
+    featureBackend->beginPropertyUpdate();
+    featureBackend->recordProperty(u"intProperty"_s, 43);
+    QCOMPARE(featureBackend->propertyStateVersion(), version + 2);
+    featureBackend->commitPropertyUpdate();
+    QCOMPARE(propertiesChangedSpy.count(), 0);
+
+    // But a resuming feature applies it
+    f->setBackendUpdatesEnabled(false);
+    featureBackend->recordProperty(u"intProperty"_s, 100);
+    f->setBackendUpdatesEnabled(true);
+    QCOMPARE(f->intProperty(), 100);
+    QCOMPARE(propertiesChangedSpy.count(), 0);
+}
+
+void BaseTest::testZones()
+{
+    if (m_isModel)
+        QSKIP("Only features can be zoned");
+
+    TestZonedFeatureBackend zonedBackend;
+    zonedBackend.setZones({ u"FrontLeft"_s, u"FrontRight"_s });
+    QIfProxyServiceObject serviceObject({{ u"testZonedFeature"_s, &zonedBackend }});
+
+    TestZonedFeature f;
+    QSignalSpy availableZonesSpy(&f, &QIfAbstractZonedFeature::availableZonesChanged);
+    QSignalSpy zonesSpy(&f, &QIfAbstractZonedFeature::zonesChanged);
+    QVERIFY(f.setServiceObject(&serviceObject));
+
+    // All zones are announced at once
+    const QStringList zones = { u"FrontLeft"_s, u"FrontRight"_s };
+    QCOMPARE(availableZonesSpy.count(), 1);
+    QCOMPARE(availableZonesSpy.at(0).at(0).toStringList(), zones);
+    QCOMPARE(zonesSpy.count(), 1);
+    QCOMPARE(f.availableZones(), zones);
+    QCOMPARE(f.zones().count(), 2);
+
+    for (const QString &zone : zones) {
+        QIfAbstractZonedFeature *zoneFeature = f.zoneAt(zone);
+        QVERIFY(zoneFeature);
+        QCOMPARE(zoneFeature->zone(), zone);
+    }
+    QVERIFY(!f.zoneAt(u"Rear"_s));
+
+    // Reporting the known zones again doesn't add anything
+    availableZonesSpy.clear();
+    zonesSpy.clear();
+    zonedBackend.initialize();
+    QCOMPARE(availableZonesSpy.count(), 0);
+    QCOMPARE(zonesSpy.count(), 0);
+    QCOMPARE(f.zones().count(), 2);
+
+    // New zones are added to the existing ones and announced once
+    zonedBackend.setZones({ u"FrontLeft"_s, u"FrontRight"_s, u"RearLeft"_s, u"RearRight"_s });
+    QCOMPARE(availableZonesSpy.count(), 1);
+    QCOMPARE(zonesSpy.count(), 1);
+    QCOMPARE(f.availableZones(), QStringList({ u"FrontLeft"_s, u"FrontRight"_s, u"RearLeft"_s, u"RearRight"_s }));
+    QCOMPARE(f.zoneAt(u"FrontLeft"_s)->zone(), u"FrontLeft"_s);
+    QCOMPARE(f.zoneAt(u"RearRight"_s)->zone(), u"RearRight"_s);
+
+    // The zones are removed together with the service object
+    availableZonesSpy.clear();
+    zonesSpy.clear();
+    QVERIFY(f.setServiceObject(nullptr));
+    QCOMPARE(availableZonesSpy.count(), 1);
+    QCOMPARE(zonesSpy.count(), 1);
+    QVERIFY(f.availableZones().isEmpty());
+    QVERIFY(!f.zoneAt(u"FrontLeft"_s));
+}
+
 void BaseTest::testLoader()
 {
     TestBackend* backend = new TestBackend();
@@ -7,6 +7,7 @@
 
 #include <qifconfiguration.h>
 #include <private/qifconfiguration_p.h>
+#include <private/qifabstractfeature_p.h>
 
 #include <qifsimulationengine.h>
 #include <qifabstractfeature.h>
@@ -32,6 +33,31 @@ public:
     }
 };
 
+class ThrottledConfigTestFeaturePrivate : public QIfAbstractFeaturePrivate
+{
+public:
+    ThrottledConfigTestFeaturePrivate(QIfAbstractFeature *parent)
+        : QIfAbstractFeaturePrivate("testFeature", parent)
+    {
+        m_supportsPropertyWritePolicies = true;
+    }
+};
+
+// Like the features generated by ifcodegen, which throttle their property writes
+class ThrottledConfigTestFeature : public QIfAbstractFeature
+{
+    Q_OBJECT
+
+public:
+    ThrottledConfigTestFeature(QObject *parent = nullptr)
+        : QIfAbstractFeature(*new ThrottledConfigTestFeaturePrivate(this), parent)
+    {}
+
+    virtual void clearServiceObject() override
+    {
+    }
+};
+
 class ConfigTestFeatureListModel : public QIfAbstractFeatureListModel
 {
     Q_OBJECT
@@ -120,6 +146,7 @@ private Q_SLOTS:
     void serviceObject();
     void backendUpdatesEnabled();
     void asynchronousBackendLoading();
+    void propertyWritePolicies();
 
     void emptySettingsFile();
     void emptyGroupSettingsFile();
@@ -218,6 +245,9 @@ void tst_QIfConfiguration::noConfiguration()
     QVERIFY(!QIfConfiguration::isAsynchronousBackendLoadingSet("test"));
     QCOMPARE(QIfConfiguration::asynchronousBackendLoading("test"), false);
 
+    QVERIFY(!QIfConfiguration::arePropertyWritePoliciesSet("test"));
+    QVERIFY(QIfConfiguration::propertyWritePolicies("test").isEmpty());
+
     // None of the above functions should create a SettingsObject
     QVERIFY(QIfConfigurationManager::instance()->m_configurationHash.isEmpty());
     QVERIFY(QIfConfigurationManager::instance()->m_settingsHash.isEmpty());
@@ -468,6 +498,55 @@ void tst_QIfConfiguration::asynchronousBackendLoading()
     QCOMPARE(spy.data()[0][0], false);
 }
 
+void tst_QIfConfiguration::propertyWritePolicies()
+{
+    // call static setter
+    QVariantMap policies = {{"volume", QVariantMap({{"policy", "coalesce"}, {"interval", 50}})}};
+    QVERIFY(QIfConfiguration::setPropertyWritePolicies("staticGroup", policies));
+    QVERIFY(QIfConfiguration::exists("staticGroup"));
+    QVERIFY(QIfConfiguration::arePropertyWritePoliciesSet("staticGroup"));
+    QCOMPARE(QIfConfiguration::propertyWritePolicies("staticGroup"), policies);
+
+    // Verify that reading the setting using the object API works as well
+    QIfConfiguration staticGroupConfig("staticGroup");
+    QCOMPARE(staticGroupConfig.propertyWritePolicies(), policies);
+
+    // Create Configuration and call that method
+    QIfConfiguration config("objectGroup");
+    QVERIFY(config.isValid());
+    QVERIFY(config.setPropertyWritePolicies(policies));
+    QCOMPARE(config.propertyWritePolicies(), policies);
+    QVERIFY(QIfConfiguration::exists("objectGroup"));
+    QVERIFY(QIfConfiguration::arePropertyWritePoliciesSet("objectGroup"));
+
+    // Test the change signal
+    QSignalSpy spy(&config, &QIfConfiguration::propertyWritePoliciesChanged);
+    QVERIFY(spy.isValid());
+    policies = {{"volume", QVariantMap({{"policy", "commitOnIdle"}})}};
+    QVERIFY(config.setPropertyWritePolicies(policies));
+    QCOMPARE(config.propertyWritePolicies(), policies);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.data()[0][0], policies);
+
+    // A policy without an interval can't be used and is reported when it is applied
+    ThrottledConfigTestFeature feature;
+    QTest::ignoreMessage(QtWarningMsg, "The write policy of property 'volume' needs an interval greater than 0. Using 'immediate' instead.");
+    feature.setConfigurationId("objectGroup");
+    QVERIFY(QIfAbstractFeaturePrivate::get(&feature)->m_writeThrottle);
+
+    // Features which don't throttle their property writes ignore the policies
+    ConfigTestFeature unthrottledFeature;
+    QTest::ignoreMessage(QtWarningMsg, "Ignoring the propertyWritePolicies for 'testFeature': The feature doesn't support property write policies");
+    unthrottledFeature.setConfigurationId("objectGroup");
+    QVERIFY(!QIfAbstractFeaturePrivate::get(&unthrottledFeature)->m_writeThrottle);
+
+    // The same applies when the policies are changed for existing features
+    QTest::ignoreMessage(QtWarningMsg, "Ignoring the propertyWritePolicies for 'testFeature': The feature doesn't support property write policies");
+    policies = {{"volume", QVariantMap({{"policy", "coalesce"}, {"interval", 50}})}};
+    QVERIFY(config.setPropertyWritePolicies(policies));
+    QVERIFY(!QIfAbstractFeaturePrivate::get(&unthrottledFeature)->m_writeThrottle);
+}
+
 void tst_QIfConfiguration::emptySettingsFile()
 {
     // Reading a empty file shouldn't cause any problem
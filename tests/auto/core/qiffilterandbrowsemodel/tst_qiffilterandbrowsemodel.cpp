@@ -140,6 +140,17 @@ public:
         Q_UNUSED(identifier)
         m_filterTerm = term;
         m_orderTerms = orderTerms;
+        m_setupFilterCount++;
+    }
+
+    QIfAbstractQueryTerm *filterTerm() const
+    {
+        return m_filterTerm;
+    }
+
+    int setupFilterCount() const
+    {
+        return m_setupFilterCount;
     }
 
     virtual void fetchData(const QUuid &identifier, int start, int count) override
@@ -341,6 +352,7 @@ private:
     QString m_contentType;
     QIfAbstractQueryTerm *m_filterTerm = nullptr;
     QList<QIfOrderTerm> m_orderTerms;
+    int m_setupFilterCount = 0;
 };
 
 class TestServiceObject : public QIfServiceObject
@@ -401,8 +413,11 @@ private Q_SLOTS:
     void testDataChangedMode_jump();
     void testNavigation_data();
     void testNavigation();
+    void testNavigationHistory();
     void testFilter_data();
     void testFilter();
+    void testQueryCache();
+    void testQueryDelay();
     void testEditing();
     void testIndexOf_qml();
     void testInputErrors();
@@ -820,6 +835,79 @@ void tst_QIfFilterAndBrowseModel::testNavigation()
     qDeleteAll(modelStack);
 }
 
+void tst_QIfFilterAndBrowseModel::testNavigationHistory()
+{
+    TestServiceObject *service = new TestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->initializeNavigationData();
+
+    QIfFilterAndBrowseModel model;
+    QSignalSpy historySizeSpy(&model, &QIfFilterAndBrowseModel::historySizeChanged);
+    model.setHistorySize(1);
+    QCOMPARE(historySizeSpy.count(), 1);
+    model.setServiceObject(service);
+    model.setContentType("levelOne");
+
+    // Fetch a second chunk, which needs to be restored as well
+    model.fetchMore(QModelIndex());
+    QCOMPARE(model.rowCount(), model.chunkSize() * 2);
+
+    QVERIFY(!model.goForward(5, QIfFilterAndBrowseModel::InModelNavigation));
+    QCOMPARE(model.at<QIfStandardItem>(1).id(), QLatin1String("levelTwo 1"));
+    QVERIFY(!model.goForward(1, QIfFilterAndBrowseModel::InModelNavigation));
+    QCOMPARE(model.at<QIfStandardItem>(1).id(), QLatin1String("levelThree 1"));
+
+    QSignalSpy historyRestoredSpy(&model, &QIfFilterAndBrowseModel::historyRestored);
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    QSignalSpy dataChangedSpy(&model, &QAbstractItemModel::dataChanged);
+    QSignalSpy fetchDataSpy(service->testBackend(), &FilterTestBackend::dataFetched);
+
+    // The last level is restored from the history and only revalidated
+    model.goBack();
+    QCOMPARE(historyRestoredSpy.count(), 1);
+    QCOMPARE(historyRestoredSpy.at(0).at(0).toInt(), 1);
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(fetchDataSpy.count(), 1);
+    QCOMPARE(dataChangedSpy.count(), 1);
+    QCOMPARE(model.contentType(), QLatin1String("levelTwo"));
+    QCOMPARE(model.rowCount(), model.chunkSize());
+    QCOMPARE(model.at<QIfStandardItem>(1).id(), QLatin1String("levelTwo 1"));
+    QVERIFY(model.canGoForward(1));
+    QVERIFY(model.canGoBack());
+
+    // Only one level is kept, the first level needs to be fetched again
+    historyRestoredSpy.clear();
+    resetSpy.clear();
+    model.goBack();
+    QVERIFY(!historyRestoredSpy.count());
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(model.contentType(), QLatin1String("levelOne"));
+    QCOMPARE(model.rowCount(), model.chunkSize());
+
+    // Both chunks are restored when the history is big enough
+    model.setHistorySize(2);
+    model.fetchMore(QModelIndex());
+    QVERIFY(!model.goForward(5, QIfFilterAndBrowseModel::InModelNavigation));
+    QCOMPARE(model.contentType(), QLatin1String("levelTwo"));
+
+    fetchDataSpy.clear();
+    model.goBack();
+    QCOMPARE(historyRestoredSpy.count(), 1);
+    QCOMPARE(historyRestoredSpy.at(0).at(0).toInt(), 5);
+    QCOMPARE(fetchDataSpy.count(), 2);
+    QCOMPARE(model.rowCount(), model.chunkSize() * 2);
+    QCOMPARE(model.at<QIfStandardItem>(model.chunkSize() + 1).id(), QLatin1String("levelOne ") + QString::number(model.chunkSize() + 1));
+    QVERIFY(!model.canGoBack());
+
+    // Setting a new content type starts a new history
+    QVERIFY(!model.goForward(5, QIfFilterAndBrowseModel::InModelNavigation));
+    model.setContentType("levelOne");
+    historyRestoredSpy.clear();
+    QTest::ignoreMessage(QtWarningMsg, "Can't go backward anymore");
+    model.goBack();
+    QVERIFY(!historyRestoredSpy.count());
+}
+
 // If more complex queries are added here you also need to make sure the backend can handle it.
 void tst_QIfFilterAndBrowseModel::testFilter_data()
 {
@@ -871,6 +959,73 @@ void tst_QIfFilterAndBrowseModel::testFilter()
     QCOMPARE(model.at<QIfStandardItem>(0).id(), QString::number(0));
 }
 
+void tst_QIfFilterAndBrowseModel::testQueryCache()
+{
+    TestServiceObject *service = new TestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->setCapabilities(QtInterfaceFrameworkModule::SupportsFiltering);
+    service->testBackend()->initializeFilterData();
+
+    QIfFilterAndBrowseModel model;
+    model.setServiceObject(service);
+    model.setContentType("filter");
+
+    model.setQuery("id>10");
+    QIfAbstractQueryTerm *term = service->testBackend()->filterTerm();
+    QVERIFY(term);
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QString::number(11));
+
+    // Using the same query again doesn't parse it again
+    model.setQuery(QString());
+    QVERIFY(!service->testBackend()->filterTerm());
+    model.setQuery("id>10");
+    QCOMPARE(service->testBackend()->filterTerm(), term);
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QString::number(11));
+
+    // Invalid queries are cached as well and still report the error
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Got foo but expected"));
+    model.setQuery("foo>10");
+    model.setQuery("id>10");
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Got foo but expected"));
+    model.setQuery("foo>10");
+}
+
+void tst_QIfFilterAndBrowseModel::testQueryDelay()
+{
+    TestServiceObject *service = new TestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->setCapabilities(QtInterfaceFrameworkModule::SupportsFiltering);
+    service->testBackend()->initializeFilterData();
+
+    QIfFilterAndBrowseModel model;
+    model.setServiceObject(service);
+    model.setContentType("filter");
+
+    QSignalSpy queryDelaySpy(&model, &QIfFilterAndBrowseModel::queryDelayChanged);
+    model.setQueryDelay(50);
+    QCOMPARE(queryDelaySpy.count(), 1);
+    QCOMPARE(model.queryDelay(), 50);
+
+    // Only the last query is passed to the backend
+    QSignalSpy resetSpy(&model, &QAbstractItemModel::modelReset);
+    const int setupFilterCount = service->testBackend()->setupFilterCount();
+    model.setQuery("id>1");
+    model.setQuery("id>10");
+    QCOMPARE(model.query(), QLatin1String("id>10"));
+    QCOMPARE(service->testBackend()->setupFilterCount(), setupFilterCount);
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QString::number(0));
+
+    QVERIFY(resetSpy.wait());
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(service->testBackend()->setupFilterCount(), setupFilterCount + 1);
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QString::number(11));
+
+    // Disabling the delay applies a waiting query right away
+    model.setQuery("id>20");
+    model.setQueryDelay(0);
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QString::number(21));
+}
+
 void tst_QIfFilterAndBrowseModel::testEditing()
 {
     TestServiceObject *service = new TestServiceObject();
@@ -7,6 +7,7 @@
 #include <QIfAbstractFeature>
 #include <QIfServiceManager>
 #include <QIfPagingModel>
+#include <QIfTypedPagingModel>
 #include <private/qifpagingmodel_p.h>
 #include <QIfPagingModelInterface>
 #include <QIfStandardItem>
@@ -16,6 +17,8 @@
 #include <QScopedPointer>
 #include <private/qobject_p.h>
 
+#include <tuple>
+
 //TODO Add test with multiple model instances, requesting different data at the same time
 //TODO Test the signal without a valid identifier
 
@@ -37,15 +40,15 @@ public:
     }
 
     //Adds very simple Data which can be used for most of the unit tests
-    void initializeSimpleData()
+    void initializeSimpleData(int count = 100)
     {
-        m_list = createItemList("simple");
+        m_list = createItemList("simple", count);
     }
 
-    QVariantList createItemList(const QString &name)
+    QVariantList createItemList(const QString &name, int count = 100)
     {
         QVariantList list;
-        for (int i=0; i<100; i++) {
+        for (int i=0; i<count; i++) {
             QIfStandardItem item;
             item.setId(name + QLatin1String(" ") + QString::number(i));
             QVariantMap map;
@@ -79,8 +82,41 @@ public:
         emit unregisterInstanceCalled(identifier);
     }
 
+    //Requests are only answered once sendDeferredReplies() is called
+    void setDeferReplies(bool deferReplies)
+    {
+        m_deferReplies = deferReplies;
+    }
+
+    void sendDeferredReplies()
+    {
+        const auto requests = std::exchange(m_deferredRequests, {});
+        const bool deferReplies = std::exchange(m_deferReplies, false);
+        for (const auto &request : requests)
+            fetchData(std::get<0>(request), std::get<1>(request), std::get<2>(request));
+        m_deferReplies = deferReplies;
+    }
+
+    //Only answers the oldest deferred request
+    void sendDeferredReply()
+    {
+        if (m_deferredRequests.isEmpty())
+            return;
+        const auto request = m_deferredRequests.takeFirst();
+        const bool deferReplies = std::exchange(m_deferReplies, false);
+        fetchData(std::get<0>(request), std::get<1>(request), std::get<2>(request));
+        m_deferReplies = deferReplies;
+    }
+
     void fetchData(const QUuid &identifier, int start, int count) override
     {
+        emit fetchDataCalled(start);
+
+        if (m_deferReplies) {
+            m_deferredRequests.append({ identifier, start, count });
+            return;
+        }
+
         emit supportedCapabilitiesChanged(identifier, m_caps);
 
         if (m_caps.testFlag(QtInterfaceFrameworkModule::SupportsGetSize))
@@ -123,13 +159,23 @@ public:
         emit dataChanged(QUuid(), variantLIst, min, max - min + 1);
     }
 
+    void replace(int start, int count, const QVariantList &items)
+    {
+        m_list = m_list.mid(0, start) + items + m_list.mid(start + count);
+
+        emit dataChanged(QUuid(), items, start, count);
+    }
+
 Q_SIGNALS:
     void registerInstanceCalled(const QUuid &identifier);
     void unregisterInstanceCalled(const QUuid &identifier);
+    void fetchDataCalled(int start);
 
 private:
     QVariantList m_list;
     QtInterfaceFrameworkModule::ModelCapabilities m_caps;
+    bool m_deferReplies = false;
+    QList<std::tuple<QUuid, int, int>> m_deferredRequests;
 };
 
 class PagingTestServiceObject : public QIfServiceObject
@@ -188,14 +234,23 @@ private Q_SLOTS:
     void testBasic_qml();
     void testBrokenData();
     void testGetAt();
+    void testTypedModel();
     void testFetchMore_data();
     void testFetchMore();
     void testDataChangedMode();
     void testReload();
     void testDataChangedMode_jump();
+    void testCacheSize();
+    void testPrefetch();
+    void testPrefetchCacheSize();
+    void testPendingRequests();
     void testEditing();
+    void testEditing_ranges();
     void testMissingCapabilities();
 
+    void benchmarkDataChanged_data();
+    void benchmarkDataChanged();
+
 private:
     QIfServiceManager *manager;
 };
@@ -330,6 +385,39 @@ void tst_QIfPagingModel::testGetAt()
     QCOMPARE(var.value<QIfStandardItem>().id(), item.id());
 }
 
+void tst_QIfPagingModel::testTypedModel()
+{
+    PagingTestServiceObject *service = new PagingTestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->initializeSimpleData();
+
+    QIfTypedPagingModel<QIfStandardItem> model;
+    auto *d = reinterpret_cast<QIfPagingModelPrivate*> (QObjectPrivate::get(&model));
+    QCOMPARE(d->m_itemMetaType, QMetaType::fromType<QIfStandardItem>());
+    QVERIFY(d->m_itemCast);
+
+    model.setServiceObject(service);
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QLatin1String("simple 0"));
+    QVERIFY(model.data(model.index(0), QIfPagingModel::NameRole).isValid());
+    QCOMPARE(model.data(model.index(0), QIfPagingModel::ItemRole).value<QIfStandardItem>().id(), QLatin1String("simple 0"));
+
+    //Rows of a different type are converted to the type of the model, if possible
+    QMetaType::registerConverter<QString, QIfStandardItem>([](const QString &id) {
+        QIfStandardItem item;
+        item.setId(id);
+        return item;
+    });
+    service->testBackend()->replace(0, 1, { QVariant(QStringLiteral("converted")) });
+    QCOMPARE(d->m_itemList.at(0).metaType(), QMetaType::fromType<QIfStandardItem>());
+    QCOMPARE(model.data(model.index(0), QIfPagingModel::NameRole).toString(), QLatin1String("converted"));
+
+    //Rows which can't be converted are kept as they are
+    service->testBackend()->replace(1, 1, { QVariant::fromValue(PagingTestGadget()) });
+    QCOMPARE(d->m_itemList.at(1).metaType(), QMetaType::fromType<PagingTestGadget>());
+    QTest::ignoreMessage(QtWarningMsg, "The passed QVariant is not derived from QIfStandardItem");
+    QVERIFY(!model.data(model.index(1), QIfPagingModel::NameRole).isValid());
+}
+
 void tst_QIfPagingModel::testFetchMore_data()
 {
     QTest::addColumn<int>("chunkSize");
@@ -501,6 +589,211 @@ void tst_QIfPagingModel::testDataChangedMode_jump()
     QCOMPARE(fetchDataSpy.at(0).at(2).toInt(), chunkBegin);
 }
 
+void tst_QIfPagingModel::testCacheSize()
+{
+    PagingTestServiceObject *service = new PagingTestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->setCapabilities(QtInterfaceFrameworkModule::SupportsGetSize);
+    service->testBackend()->initializeSimpleData();
+
+    QIfPagingModel model;
+    model.setServiceObject(service);
+    QVERIFY(model.serviceObject());
+
+    model.setLoadingType(QIfPagingModel::DataChanged);
+    QCOMPARE(model.loadingType(), QIfPagingModel::DataChanged);
+    QCOMPARE(model.rowCount(), 100);
+
+    QSignalSpy cacheSizeChangedSpy(&model, SIGNAL(cacheSizeChanged(int)));
+    model.setCacheSize(2);
+    QCOMPARE(model.cacheSize(), 2);
+    QCOMPARE(cacheSizeChangedSpy.count(), 1);
+
+    auto *d = reinterpret_cast<QIfPagingModelPrivate*> (QObjectPrivate::get(&model));
+    QVERIFY(d->m_availableChunks.testBit(0));
+
+    // The first access fetches the chunk, the second one returns the data
+    const int chunkSize = model.chunkSize();
+    model.get(chunkSize);
+    QCOMPARE(model.at<QIfStandardItem>(chunkSize).id(), QLatin1String("simple ") + QString::number(chunkSize));
+    QVERIFY(d->m_availableChunks.testBit(0));
+    QVERIFY(d->m_availableChunks.testBit(1));
+
+    // Loading a third chunk evicts the least recently used one
+    model.get(chunkSize * 2);
+    QCOMPARE(model.at<QIfStandardItem>(chunkSize * 2).id(), QLatin1String("simple ") + QString::number(chunkSize * 2));
+    QVERIFY(!d->m_availableChunks.testBit(0));
+    QVERIFY(!d->m_itemList.at(0).isValid());
+    QVERIFY(d->m_availableChunks.testBit(1));
+    QVERIFY(d->m_availableChunks.testBit(2));
+
+    // Accessing the evicted chunk fetches it again
+    QSignalSpy fetchDataSpy(service->testBackend(), SIGNAL(dataFetched(const QUuid &, const QList<QVariant> &, int , bool )));
+    model.get(0);
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QLatin1String("simple 0"));
+    QCOMPARE(fetchDataSpy.count(), 1);
+    QCOMPARE(fetchDataSpy.at(0).at(2).toInt(), 0);
+    QVERIFY(!d->m_availableChunks.testBit(1));
+    QVERIFY(d->m_availableChunks.testBit(2));
+}
+
+void tst_QIfPagingModel::testPrefetch()
+{
+    PagingTestServiceObject *service = new PagingTestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->setCapabilities(QtInterfaceFrameworkModule::SupportsGetSize);
+    service->testBackend()->initializeSimpleData();
+
+    QIfPagingModel model;
+    model.setServiceObject(service);
+    QVERIFY(model.serviceObject());
+
+    model.setLoadingType(QIfPagingModel::DataChanged);
+    QCOMPARE(model.loadingType(), QIfPagingModel::DataChanged);
+    QCOMPARE(model.rowCount(), 100);
+
+    QSignalSpy prefetchChunksChangedSpy(&model, SIGNAL(prefetchChunksChanged(int)));
+    model.setPrefetchChunks(2);
+    QCOMPARE(model.prefetchChunks(), 2);
+    QCOMPARE(prefetchChunksChangedSpy.count(), 1);
+
+    // Accessing the first chunk prefetches the following two chunks
+    QSignalSpy fetchDataSpy(service->testBackend(), SIGNAL(dataFetched(const QUuid &, const QList<QVariant> &, int , bool )));
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QLatin1String("simple 0"));
+    QCOMPARE(fetchDataSpy.count(), 2);
+    QCOMPARE(fetchDataSpy.at(0).at(2).toInt(), model.chunkSize());
+    QCOMPARE(fetchDataSpy.at(1).at(2).toInt(), model.chunkSize() * 2);
+
+    // The data is already available, no additional fetch is needed
+    fetchDataSpy.clear();
+    QCOMPARE(model.at<QIfStandardItem>(model.chunkSize()).id(), QLatin1String("simple ") + QString::number(model.chunkSize()));
+    QCOMPARE(model.at<QIfStandardItem>(model.chunkSize() * 2).id(), QLatin1String("simple ") + QString::number(model.chunkSize() * 2));
+    // Only the last chunk is fetched, as all others are already available
+    QCOMPARE(fetchDataSpy.count(), 1);
+    QCOMPARE(fetchDataSpy.at(0).at(2).toInt(), model.chunkSize() * 3);
+}
+
+void tst_QIfPagingModel::testPrefetchCacheSize()
+{
+    PagingTestServiceObject *service = new PagingTestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->setCapabilities(QtInterfaceFrameworkModule::SupportsGetSize);
+    service->testBackend()->initializeSimpleData();
+
+    QIfPagingModel model;
+    model.setServiceObject(service);
+    QVERIFY(model.serviceObject());
+
+    model.setLoadingType(QIfPagingModel::DataChanged);
+    QCOMPARE(model.rowCount(), 100);
+    model.setCacheSize(2);
+    model.setPrefetchChunks(1);
+
+    auto *d = reinterpret_cast<QIfPagingModelPrivate*> (QObjectPrivate::get(&model));
+    const int chunkSize = model.chunkSize();
+    QSignalSpy fetchDataCalledSpy(service->testBackend(), SIGNAL(fetchDataCalled(int)));
+
+    // The view shows the rows of the first two chunks and reads them in turns. Only the second
+    // chunk is prefetched, as the cache can't hold more than the visible chunks.
+    for (int i = 0; i < 5; i++) {
+        QCOMPARE(model.at<QIfStandardItem>(0).id(), QLatin1String("simple 0"));
+        QCOMPARE(model.at<QIfStandardItem>(chunkSize).id(), QLatin1String("simple ") + QString::number(chunkSize));
+    }
+    QCOMPARE(fetchDataCalledSpy.count(), 1);
+    QCOMPARE(fetchDataCalledSpy.at(0).at(0).toInt(), chunkSize);
+
+    // Scrolling on evicts the chunk which isn't visible anymore, but never the visible ones
+    fetchDataCalledSpy.clear();
+    model.get(chunkSize * 2);
+    for (int i = 0; i < 5; i++) {
+        QCOMPARE(model.at<QIfStandardItem>(chunkSize).id(), QLatin1String("simple ") + QString::number(chunkSize));
+        QCOMPARE(model.at<QIfStandardItem>(chunkSize * 2).id(), QLatin1String("simple ") + QString::number(chunkSize * 2));
+    }
+    QCOMPARE(fetchDataCalledSpy.count(), 1);
+    QCOMPARE(fetchDataCalledSpy.at(0).at(0).toInt(), chunkSize * 2);
+    QVERIFY(!d->m_availableChunks.testBit(0));
+    QVERIFY(d->m_availableChunks.testBit(1));
+    QVERIFY(d->m_availableChunks.testBit(2));
+}
+
+void tst_QIfPagingModel::testPendingRequests()
+{
+    PagingTestServiceObject *service = new PagingTestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->setCapabilities(QtInterfaceFrameworkModule::SupportsGetSize);
+    service->testBackend()->initializeSimpleData();
+
+    QIfPagingModel model;
+    model.setServiceObject(service);
+    QVERIFY(model.serviceObject());
+
+    model.setLoadingType(QIfPagingModel::DataChanged);
+    QCOMPARE(model.loadingType(), QIfPagingModel::DataChanged);
+    QCOMPARE(model.rowCount(), 100);
+
+    auto *d = reinterpret_cast<QIfPagingModelPrivate*> (QObjectPrivate::get(&model));
+    const int chunkSize = model.chunkSize();
+    service->testBackend()->setDeferReplies(true);
+    QSignalSpy fetchDataCalledSpy(service->testBackend(), SIGNAL(fetchDataCalled(int)));
+
+    // A second request for a chunk which is still loading is dropped
+    model.get(chunkSize);
+    QCOMPARE(fetchDataCalledSpy.count(), 1);
+    QVERIFY(d->m_pendingChunks.contains(1));
+    d->fetchData(chunkSize);
+    QCOMPARE(fetchDataCalledSpy.count(), 1);
+
+    // A late reply for a request issued before the reset is discarded
+    model.reload();
+    QCOMPARE(fetchDataCalledSpy.count(), 2);
+    service->testBackend()->sendDeferredReplies();
+    QCOMPARE(model.rowCount(), 100);
+    QVERIFY(d->m_pendingChunks.isEmpty());
+    QVERIFY(!d->m_availableChunks.testBit(1));
+    QVERIFY(!d->m_itemList.at(chunkSize).isValid());
+    QVERIFY(d->m_availableChunks.testBit(0));
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QLatin1String("simple 0"));
+
+    // The same chunk is requested again after the reset. Only the reply to the second request is
+    // used, even though both replies are for the same rows.
+    fetchDataCalledSpy.clear();
+    model.reload();
+    model.reload();
+    QCOMPARE(fetchDataCalledSpy.count(), 2);
+    QCOMPARE(fetchDataCalledSpy.at(0).at(0).toInt(), 0);
+    QCOMPARE(fetchDataCalledSpy.at(1).at(0).toInt(), 0);
+    service->testBackend()->sendDeferredReply();
+    QVERIFY(d->m_pendingChunks.contains(0));
+    QVERIFY(!d->m_itemList.value(0).isValid());
+    service->testBackend()->sendDeferredReply();
+    QVERIFY(d->m_pendingChunks.isEmpty());
+    QVERIFY(d->m_sentRequests.isEmpty());
+    QCOMPARE(model.rowCount(), 100);
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QLatin1String("simple 0"));
+
+    // Requests which time out are retried until the retry limit is reached, without the model
+    // being accessed
+    QSignalSpy fetchTimeoutChangedSpy(&model, SIGNAL(fetchTimeoutChanged(int)));
+    QCOMPARE(model.fetchTimeout(), 10000);
+    model.setFetchTimeout(50);
+    QCOMPARE(model.fetchTimeout(), 50);
+    QCOMPARE(fetchTimeoutChangedSpy.count(), 1);
+
+    fetchDataCalledSpy.clear();
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Giving up"));
+    model.get(chunkSize * 2);
+    QCOMPARE(fetchDataCalledSpy.count(), 1);
+    QTRY_VERIFY(d->m_pendingChunks.isEmpty());
+    QCOMPARE(fetchDataCalledSpy.count(), d->m_maxFetchRetries + 1);
+    for (const QVariantList &call : std::as_const(fetchDataCalledSpy))
+        QCOMPARE(call.at(0).toInt(), chunkSize * 2);
+    QVERIFY(!d->m_availableChunks.testBit(2));
+
+    // Replies which arrive after giving up are discarded as well
+    service->testBackend()->sendDeferredReplies();
+    QVERIFY(!d->m_availableChunks.testBit(2));
+}
+
 void tst_QIfPagingModel::testEditing()
 {
     PagingTestServiceObject *service = new PagingTestServiceObject();
@@ -544,6 +837,49 @@ void tst_QIfPagingModel::testEditing()
     QCOMPARE(model.at<QIfStandardItem>(newIndex).id(), QLatin1String("simple 10"));
 }
 
+void tst_QIfPagingModel::testEditing_ranges()
+{
+    PagingTestServiceObject *service = new PagingTestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->initializeSimpleData();
+
+    QIfPagingModel model;
+    model.setServiceObject(service);
+
+    QCOMPARE(model.at<QIfStandardItem>(0).id(), QLatin1String("simple 0"));
+    QCOMPARE(model.rowCount(), model.chunkSize());
+
+    // Replace 5 rows by 3 new rows: 3 rows are updated and the remaining 2 rows are removed
+    QSignalSpy updateSpy(&model, SIGNAL(dataChanged(const QModelIndex &, const QModelIndex &, const QVector<int> &)));
+    QSignalSpy removedSpy(&model, SIGNAL(rowsRemoved(const QModelIndex &, int , int )));
+    service->testBackend()->replace(0, 5, service->testBackend()->createItemList("replaced", 3));
+    QCOMPARE(updateSpy.count(), 1);
+    QCOMPARE(updateSpy.at(0).at(0).toModelIndex().row(), 0);
+    QCOMPARE(updateSpy.at(0).at(1).toModelIndex().row(), 2);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 3);
+    QCOMPARE(removedSpy.at(0).at(2).toInt(), 4);
+    QCOMPARE(model.rowCount(), model.chunkSize() - 2);
+    QCOMPARE(model.at<QIfStandardItem>(2).id(), QLatin1String("replaced 2"));
+    QCOMPARE(model.at<QIfStandardItem>(3).id(), QLatin1String("simple 5"));
+    QCOMPARE(model.at<QIfStandardItem>(4).id(), QLatin1String("simple 6"));
+
+    // Replace 3 rows by 5 new rows: 3 rows are updated and 2 new rows are inserted
+    updateSpy.clear();
+    QSignalSpy insertSpy(&model, SIGNAL(rowsInserted(const QModelIndex &, int , int )));
+    service->testBackend()->replace(0, 3, service->testBackend()->createItemList("inserted", 5));
+    QCOMPARE(updateSpy.count(), 1);
+    QCOMPARE(updateSpy.at(0).at(0).toModelIndex().row(), 0);
+    QCOMPARE(updateSpy.at(0).at(1).toModelIndex().row(), 2);
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(insertSpy.at(0).at(1).toInt(), 3);
+    QCOMPARE(insertSpy.at(0).at(2).toInt(), 4);
+    QCOMPARE(model.rowCount(), model.chunkSize());
+    QCOMPARE(model.at<QIfStandardItem>(3).id(), QLatin1String("inserted 3"));
+    QCOMPARE(model.at<QIfStandardItem>(4).id(), QLatin1String("inserted 4"));
+    QCOMPARE(model.at<QIfStandardItem>(5).id(), QLatin1String("simple 5"));
+}
+
 void tst_QIfPagingModel::testMissingCapabilities()
 {
     PagingTestServiceObject *service = new PagingTestServiceObject();
@@ -558,6 +894,38 @@ void tst_QIfPagingModel::testMissingCapabilities()
     QCOMPARE(model.loadingType(), QIfPagingModel::FetchMore);
 }
 
+void tst_QIfPagingModel::benchmarkDataChanged_data()
+{
+    QTest::addColumn<int>("rowCount");
+    QTest::newRow("10k") << 10000;
+    QTest::newRow("100k") << 100000;
+}
+
+void tst_QIfPagingModel::benchmarkDataChanged()
+{
+    QFETCH(int, rowCount);
+
+    PagingTestServiceObject *service = new PagingTestServiceObject();
+    manager->registerService(service, service->interfaces());
+    service->testBackend()->setCapabilities(QtInterfaceFrameworkModule::SupportsGetSize);
+    service->testBackend()->initializeSimpleData(rowCount);
+
+    QIfPagingModel model;
+    model.setServiceObject(service);
+    model.setLoadingType(QIfPagingModel::DataChanged);
+    QCOMPARE(model.rowCount(), rowCount);
+
+    const QVariantList items = service->testBackend()->createItemList("benchmark", rowCount);
+
+    QBENCHMARK {
+        // Remove all rows and insert them again
+        service->testBackend()->replace(0, rowCount, QVariantList());
+        service->testBackend()->replace(0, 0, items);
+    }
+
+    QCOMPARE(model.rowCount(), rowCount);
+}
+
 QTEST_MAIN(tst_QIfPagingModel)
 
 #include "tst_qifpagingmodel.moc"
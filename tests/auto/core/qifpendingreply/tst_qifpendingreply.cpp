@@ -7,6 +7,7 @@
 #include <QQmlEngine>
 #include <QQmlComponent>
 #include <QQmlContext>
+#include <QSharedPointer>
 
 #include <qifpendingreply.h>
 
@@ -131,6 +132,9 @@ private Q_SLOTS:
     void testTypeError();
     void testThenLater_data();
     void testThenLater();
+    void testThenReleasesCallbacks();
+    void testThenFromOtherThread();
+    void testWatcherMember();
 
 private:
     template <typename T> void test(QIfPendingReply<T> reply, bool failed, T expectedResult = T());
@@ -576,6 +580,114 @@ void tst_QIfPendingReply::testThenLater()
     }
 }
 
+void tst_QIfPendingReply::testThenReleasesCallbacks()
+{
+    auto captured = QSharedPointer<int>::create(0);
+    QWeakPointer<int> weakCaptured = captured;
+    int result = 0;
+    bool failedCalled = false;
+
+    QIfPendingReply<int> reply;
+    reply.then([captured, &result](int value) {
+        result = value + *captured;
+    }, [&failedCalled]() {
+        failedCalled = true;
+    });
+    captured.reset();
+
+    // The callbacks keep their captures alive until the result is set
+    QVERIFY(!weakCaptured.isNull());
+
+    QIfPendingReply<int> copy = reply;
+    copy.setSuccess(42);
+    QCOMPARE(result, 42);
+    QVERIFY(!failedCalled);
+    QVERIFY(reply.isSuccessful());
+    QCOMPARE(reply.reply(), 42);
+
+    // The callbacks are released once they have been called
+    QVERIFY(weakCaptured.isNull());
+
+    // The watcher shares the result with the callbacks
+    QVERIFY(reply.watcher());
+    QVERIFY(reply.watcher()->isResultAvailable());
+    QCOMPARE(reply.watcher()->value(), QVariant(42));
+
+    QIfPendingReply<void> voidReply;
+    bool voidCalled = false;
+    voidReply.then([&voidCalled]() { voidCalled = true; }, [&failedCalled]() { failedCalled = true; });
+    voidReply.setFailed();
+    QVERIFY(!voidCalled);
+    QVERIFY(failedCalled);
+}
+
+void tst_QIfPendingReply::testThenFromOtherThread()
+{
+    QThread *callbackThread = nullptr;
+    int result = 0;
+
+    QIfPendingReply<int> reply;
+    reply.then([&callbackThread, &result](int value) {
+        callbackThread = QThread::currentThread();
+        result = value;
+    });
+
+    // The callbacks are called in the thread the reply was created in
+    QScopedPointer<QThread> thread(QThread::create([reply]() mutable {
+        reply.setSuccess(42);
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+    QVERIFY(reply.isSuccessful());
+    QCOMPARE(result, 0);
+
+    QTRY_COMPARE(result, 42);
+    QCOMPARE(callbackThread, QThread::currentThread());
+
+    callbackThread = nullptr;
+    QIfPendingReply<void> failedReply;
+    failedReply.then([]() {}, [&callbackThread]() {
+        callbackThread = QThread::currentThread();
+    });
+    thread.reset(QThread::create([failedReply]() mutable {
+        failedReply.setFailed();
+    }));
+    thread->start();
+    QVERIFY(thread->wait());
+    QTRY_COMPARE(callbackThread, QThread::currentThread());
+
+    // Within the same thread the callbacks are still called right away
+    QIfPendingReply<int> sameThreadReply;
+    result = 0;
+    sameThreadReply.then([&result](int value) { result = value; });
+    sameThreadReply.setSuccess(5);
+    QCOMPARE(result, 5);
+}
+
+// Code compiled against older headers accesses the watcher member of the reply directly
+class WatcherAccessReply : public QIfPendingReply<int>
+{
+public:
+    QSharedPointer<QIfPendingReplyWatcher> watcherMember() const { return m_watcher; }
+};
+
+void tst_QIfPendingReply::testWatcherMember()
+{
+    WatcherAccessReply reply;
+    QSharedPointer<QIfPendingReplyWatcher> watcher = reply.watcherMember();
+    QVERIFY(watcher);
+    QCOMPARE(watcher.data(), reply.watcher());
+
+    QWeakPointer<QIfPendingReplyWatcher> weakWatcher = watcher;
+    QSignalSpy successSpy(watcher.data(), &QIfPendingReplyWatcher::replySuccess);
+    reply.setSuccess(42);
+    QCOMPARE(successSpy.count(), 1);
+    QCOMPARE(watcher->value(), QVariant(42));
+
+    watcher.reset();
+    QVERIFY(weakWatcher);
+}
+
 QTEST_MAIN(tst_QIfPendingReply)
 
 #include "tst_qifpendingreply.moc"
@@ -0,0 +1,553 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <QtTest>
+#include <QThread>
+#include <QLocalServer>
+
+#include <QtIfRemoteObjectsHelper/qifremoteobjectshelper.h>
+#include <QtIfRemoteObjectsHelper/rep_qifpagingmodel_replica.h>
+#include <QtIfRemoteObjectsHelper/private/qifpagingmodelqtroadapter_p.h>
+#include <QtIfRemoteObjectsHelper/private/qifremoteobjectslazyhost_p.h>
+#include <QtIfRemoteObjectsHelper/private/qifremoteobjectsreplicahelper_p.h>
+
+using namespace Qt::StringLiterals;
+
+class TestPagingModelBackend : public QIfPagingModelInterface
+{
+    Q_OBJECT
+
+public:
+    void initialize() override
+    {
+        emit initializationDone();
+    }
+
+    void registerInstance(const QUuid &identifier) override
+    {
+        m_registered.append(identifier);
+    }
+
+    void unregisterInstance(const QUuid &identifier) override
+    {
+        m_registered.removeAll(identifier);
+        m_unregistered.append(identifier);
+    }
+
+    void fetchData(const QUuid &identifier, int start, int count) override
+    {
+        Q_UNUSED(identifier)
+        Q_UNUSED(start)
+        Q_UNUSED(count)
+        m_fetchCount++;
+    }
+
+    QList<QUuid> m_registered;
+    QList<QUuid> m_unregistered;
+    int m_fetchCount = 0;
+};
+
+class tst_QIfRemoteObjectsHelper : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testSharedNode();
+    void testNodePerThread();
+    void testPagingModelInstanceSource();
+    void testPagingModelInstanceLease();
+    void testPagingModelWithoutInstanceSources();
+    void testReplicaHelperResults();
+    void testReplicaHelperTimeout();
+    void testReplicaHelperConnectionLost();
+    void testReplicaHelperMaximumPendingReplies();
+    void testReplicaHelperServiceSettings();
+    void testLazyHost_data();
+    void testLazyHost();
+    void testLazyHostStaleSocket();
+    void testLazyHostUnsupportedScheme();
+
+private:
+    void connectInstance(QIfPagingModelReplica *replica, QIfPagingModelInstanceReplica *instanceReplica, TestPagingModelBackend *backend);
+};
+
+// Lets the replica call keepAlive() and waits until it was processed by the server
+void tst_QIfRemoteObjectsHelper::connectInstance(QIfPagingModelReplica *replica, QIfPagingModelInstanceReplica *instanceReplica, TestPagingModelBackend *backend)
+{
+    const int fetchCount = backend->m_fetchCount;
+    instanceReplica->keepAlive();
+    // All calls are sent using the same connection, which means they arrive in order
+    replica->fetchData(QUuid(), 0, 1);
+    QTRY_COMPARE(backend->m_fetchCount, fetchCount + 1);
+}
+
+void tst_QIfRemoteObjectsHelper::testSharedNode()
+{
+    const QUrl url(u"local:tst_qifremoteobjectshelper_shared"_s);
+
+    // Two backends connecting to the same url share one node
+    QSharedPointer<QRemoteObjectNode> first = QIfRemoteObjectsHelper::acquireNode(url);
+    QSharedPointer<QRemoteObjectNode> second = QIfRemoteObjectsHelper::acquireNode(url);
+    QVERIFY(first);
+    QCOMPARE(second, first);
+
+    // A different url gets its own node
+    QSharedPointer<QRemoteObjectNode> other = QIfRemoteObjectsHelper::acquireNode(QUrl(u"local:tst_qifremoteobjectshelper_other"_s));
+    QVERIFY(other);
+    QVERIFY(other != first);
+
+    // The node stays alive as long as one backend still uses it
+    QPointer<QRemoteObjectNode> node = first.data();
+    first.reset();
+    QVERIFY(node);
+    QCOMPARE(QIfRemoteObjectsHelper::acquireNode(url), second);
+
+    // It is released once the last backend is gone
+    second.reset();
+    QVERIFY(!node);
+
+    // and a new one is created for the next backend
+    QSharedPointer<QRemoteObjectNode> third = QIfRemoteObjectsHelper::acquireNode(url);
+    QVERIFY(third);
+}
+
+void tst_QIfRemoteObjectsHelper::testNodePerThread()
+{
+    const QUrl url(u"local:tst_qifremoteobjectshelper_thread"_s);
+    QSharedPointer<QRemoteObjectNode> mainNode = QIfRemoteObjectsHelper::acquireNode(url);
+    QVERIFY(mainNode);
+
+    // A QRemoteObjectNode can only be used in its own thread, so another thread gets a new node
+    QRemoteObjectNode *threadNode = nullptr;
+    bool sharedInThread = false;
+    QThread *thread = QThread::create([&threadNode, &sharedInThread, url]() {
+        QSharedPointer<QRemoteObjectNode> node = QIfRemoteObjectsHelper::acquireNode(url);
+        threadNode = node.data();
+        sharedInThread = QIfRemoteObjectsHelper::acquireNode(url) == node;
+    });
+    thread->start();
+    QVERIFY(thread->wait());
+    delete thread;
+
+    QVERIFY(threadNode);
+    QVERIFY(sharedInThread);
+    QVERIFY(threadNode != mainNode.data());
+    QCOMPARE(QIfRemoteObjectsHelper::acquireNode(url), mainNode);
+}
+
+void tst_QIfRemoteObjectsHelper::testPagingModelInstanceSource()
+{
+    const QUrl url(u"local:tst_qifremoteobjectshelper_instance"_s);
+    const QString lookupName = u"testModel"_s;
+    QRemoteObjectHost host(url);
+    TestPagingModelBackend backend;
+    QIfPagingModelQtRoAdapter adapter(lookupName, &backend);
+    adapter.enableRemoting(&host);
+
+    QRemoteObjectNode client;
+    QVERIFY(client.connectToNode(url));
+    QScopedPointer<QIfPagingModelReplica> replica(client.acquire<QIfPagingModelReplica>(lookupName));
+    QVERIFY(replica->waitForSource());
+    QSignalSpy countSpy(replica.data(), &QIfPagingModelReplica::countChanged);
+
+    // Every registered instance gets its own source
+    const QUuid identifier = QUuid::createUuid();
+    replica->registerInstance(identifier);
+    QTRY_COMPARE(backend.m_registered, QList<QUuid>({ identifier }));
+    QCOMPARE(adapter.instanceSourceCount(), 1);
+
+    // Until the client is connected to it, the updates are broadcasted
+    emit backend.countChanged(identifier, 5);
+    QTRY_COMPARE(countSpy.count(), 1);
+
+    QScopedPointer<QIfPagingModelInstanceReplica> instanceReplica(client.acquire<QIfPagingModelInstanceReplica>(QIfRemoteObjectsHelper::instanceLookupName(lookupName, identifier)));
+    QVERIFY(instanceReplica->waitForSource());
+    QSignalSpy instanceCountSpy(instanceReplica.data(), &QIfPagingModelInstanceReplica::countChanged);
+    connectInstance(replica.data(), instanceReplica.data(), &backend);
+
+    // From now on the updates are only sent to the instance source
+    countSpy.clear();
+    emit backend.countChanged(identifier, 10);
+    QTRY_COMPARE(instanceCountSpy.count(), 1);
+    QCOMPARE(instanceCountSpy.at(0).at(0).toUuid(), identifier);
+    QCOMPARE(instanceCountSpy.at(0).at(1).toInt(), 10);
+
+    // Global updates are still broadcasted. They are sent after the instance update, which means
+    // the instance update would have arrived already if it were broadcasted as well
+    emit backend.countChanged(QUuid(), 3);
+    QTRY_COMPARE(countSpy.count(), 1);
+    QCOMPARE(countSpy.at(0).at(0).toUuid(), QUuid());
+    QCOMPARE(instanceCountSpy.count(), 1);
+
+    // Unregistering the instance removes its source
+    replica->unregisterInstance(identifier);
+    QTRY_COMPARE(backend.m_unregistered, QList<QUuid>({ identifier }));
+    QCOMPARE(adapter.instanceSourceCount(), 0);
+
+    adapter.disableRemoting();
+}
+
+void tst_QIfRemoteObjectsHelper::testPagingModelInstanceLease()
+{
+    const QUrl url(u"local:tst_qifremoteobjectshelper_lease"_s);
+    const QString lookupName = u"testModel"_s;
+    QRemoteObjectHost host(url);
+    TestPagingModelBackend backend;
+    QIfPagingModelQtRoAdapter adapter(lookupName, &backend);
+    adapter.setInstanceLeaseTimeout(200);
+    adapter.enableRemoting(&host);
+
+    auto client = new QRemoteObjectNode(this);
+    QVERIFY(client->connectToNode(url));
+    auto replica = client->acquire<QIfPagingModelReplica>(lookupName);
+    QVERIFY(replica->waitForSource());
+
+    // A client which supports the instance sources and one which only uses the broadcasts
+    const QUuid connectedIdentifier = QUuid::createUuid();
+    const QUuid identifier = QUuid::createUuid();
+    replica->registerInstance(connectedIdentifier);
+    replica->registerInstance(identifier);
+    QTRY_COMPARE(backend.m_registered.count(), 2);
+    QCOMPARE(adapter.instanceSourceCount(), 2);
+
+    auto instanceReplica = client->acquire<QIfPagingModelInstanceReplica>(QIfRemoteObjectsHelper::instanceLookupName(lookupName, connectedIdentifier));
+    QVERIFY(instanceReplica->waitForSource());
+    connectInstance(replica, instanceReplica, &backend);
+
+    // The instance is kept as long as the client calls keepAlive()
+    QTimer keepAliveTimer;
+    connect(&keepAliveTimer, &QTimer::timeout, instanceReplica, &QIfPagingModelInstanceReplica::keepAlive);
+    keepAliveTimer.start(20);
+
+    // The source of the client which never connected to it is removed, but the instance itself
+    // is still used
+    QTRY_COMPARE(adapter.instanceSourceCount(), 1);
+    QCOMPARE(backend.m_registered.count(), 2);
+    QVERIFY(backend.m_unregistered.isEmpty());
+
+    QTest::qWait(300);
+    QCOMPARE(adapter.instanceSourceCount(), 1);
+
+    // Once the client is gone, the instance is removed as well
+    keepAliveTimer.stop();
+    delete instanceReplica;
+    delete replica;
+    delete client;
+    QTRY_COMPARE(adapter.instanceSourceCount(), 0);
+    QCOMPARE(backend.m_unregistered, QList<QUuid>({ connectedIdentifier }));
+    QCOMPARE(backend.m_registered, QList<QUuid>({ identifier }));
+
+    adapter.disableRemoting();
+}
+
+void tst_QIfRemoteObjectsHelper::testPagingModelWithoutInstanceSources()
+{
+    const QUrl url(u"local:tst_qifremoteobjectshelper_legacy"_s);
+    const QString lookupName = u"testModel"_s;
+    QRemoteObjectHost host(url);
+    TestPagingModelBackend backend;
+    QIfPagingModelQtRoAdapter adapter(lookupName, &backend);
+    // A custom server which remotes the adapter directly can't remote the instance sources
+    QVERIFY(host.enableRemoting<QIfPagingModelAddressWrapper>(&adapter));
+
+    QRemoteObjectNode client;
+    QVERIFY(client.connectToNode(url));
+    QScopedPointer<QIfPagingModelReplica> replica(client.acquire<QIfPagingModelReplica>(lookupName));
+    QVERIFY(replica->waitForSource());
+    QSignalSpy countSpy(replica.data(), &QIfPagingModelReplica::countChanged);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(u"wasn't remoted using QIfPagingModelQtRoAdapter::enableRemoting\\(\\)"_s));
+    const QUuid identifier = QUuid::createUuid();
+    replica->registerInstance(identifier);
+    QTRY_COMPARE(backend.m_registered, QList<QUuid>({ identifier }));
+    QCOMPARE(adapter.instanceSourceCount(), 0);
+
+    // The instance source never becomes available, but all updates are broadcasted instead
+    QScopedPointer<QIfPagingModelInstanceReplica> instanceReplica(client.acquire<QIfPagingModelInstanceReplica>(QIfRemoteObjectsHelper::instanceLookupName(lookupName, identifier)));
+    QVERIFY(!instanceReplica->waitForSource(200));
+
+    emit backend.countChanged(identifier, 5);
+    QTRY_COMPARE(countSpy.count(), 1);
+    QCOMPARE(countSpy.at(0).at(0).toUuid(), identifier);
+
+    host.disableRemoting(&adapter);
+}
+
+// A call without a replica never finishes, like a call to a server which never answers
+static QRemoteObjectPendingCall unansweredCall()
+{
+    return QRemoteObjectPendingCall();
+}
+
+// The answer of a server whose result is only delivered later using pendingResultAvailable.
+// The answer is processed once the posted events are sent.
+static QRemoteObjectPendingCall deferredCall(quint64 id, bool failed = false)
+{
+    return QRemoteObjectPendingCall::fromCompletedCall(QVariant::fromValue(QIfRemoteObjectsPendingResult(id, failed)));
+}
+
+void tst_QIfRemoteObjectsHelper::testReplicaHelperResults()
+{
+    QIfRemoteObjectsReplicaHelper helper;
+
+    // A value which is returned right away
+    QIfPendingReply<int> reply = helper.toQIfPendingReply<int>(QRemoteObjectPendingCall::fromCompletedCall(QVariant(5)));
+    QCOMPARE(helper.pendingReplyCount(), 1);
+    QTRY_VERIFY(reply.isResultAvailable());
+    QVERIFY(reply.isSuccessful());
+    QCOMPARE(reply.value(), 5);
+    QCOMPARE(helper.pendingReplyCount(), 0);
+
+    // A result which is delivered later
+    QIfPendingReply<int> deferredReply = helper.toQIfPendingReply<int>(deferredCall(1));
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(helper.pendingReplyCount(), 1);
+    QVERIFY(!deferredReply.isResultAvailable());
+    helper.onPendingResultAvailable(1, true, 6);
+    QVERIFY(deferredReply.isSuccessful());
+    QCOMPARE(deferredReply.value(), 6);
+    QCOMPARE(helper.pendingReplyCount(), 0);
+
+    // A result which failed on the server
+    QIfPendingReply<int> failedReply = helper.toQIfPendingReply<int>(deferredCall(2, true));
+    QTRY_VERIFY(failedReply.isResultAvailable());
+    QVERIFY(!failedReply.isSuccessful());
+    QCOMPARE(helper.pendingReplyCount(), 0);
+}
+
+void tst_QIfRemoteObjectsHelper::testReplicaHelperTimeout()
+{
+    QVERIFY(!unansweredCall().isFinished());
+
+    QIfRemoteObjectsReplicaHelper helper;
+    QCOMPARE(helper.callTimeout(), -1);
+    helper.setCallTimeout(50);
+
+    // Both a call which is never answered and a result which is never delivered time out
+    QIfPendingReply<int> reply = helper.toQIfPendingReply<int>(unansweredCall());
+    QIfPendingReply<int> deferredReply = helper.toQIfPendingReply<int>(deferredCall(1));
+    QCOMPARE(helper.pendingReplyCount(), 2);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(u"remote calls didn't finish within 50 ms"_s));
+    QTRY_VERIFY(reply.isResultAvailable() && deferredReply.isResultAvailable());
+    QVERIFY(!reply.isSuccessful());
+    QVERIFY(!deferredReply.isSuccessful());
+    QCOMPARE(helper.timedOutReplyCount(), quint64(2));
+    QCOMPARE(helper.pendingReplyCount(), 0);
+
+    // A result which arrives after the timeout is ignored
+    helper.onPendingResultAvailable(1, true, 5);
+    QVERIFY(!deferredReply.isSuccessful());
+
+    // Without a timeout the calls stay pending
+    helper.setCallTimeout(-1);
+    QIfPendingReply<int> pendingReply = helper.toQIfPendingReply<int>(unansweredCall());
+    QTest::qWait(100);
+    QVERIFY(!pendingReply.isResultAvailable());
+    QCOMPARE(helper.pendingReplyCount(), 1);
+    QCOMPARE(helper.timedOutReplyCount(), quint64(2));
+}
+
+void tst_QIfRemoteObjectsHelper::testReplicaHelperConnectionLost()
+{
+    QIfRemoteObjectsReplicaHelper helper;
+    QSignalSpy errorSpy(&helper, &QIfRemoteObjectsReplicaHelper::errorChanged);
+
+    QIfPendingReply<int> reply = helper.toQIfPendingReply<int>(unansweredCall());
+    QIfPendingReply<int> deferredReply = helper.toQIfPendingReply<int>(deferredCall(1));
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(helper.pendingReplyCount(), 2);
+
+    // The answers will never arrive once the connection is lost
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(u"connection to the source lost"_s));
+    helper.onReplicaStateChanged(QRemoteObjectReplica::Suspect, QRemoteObjectReplica::Valid);
+    QVERIFY(reply.isResultAvailable());
+    QVERIFY(!reply.isSuccessful());
+    QVERIFY(deferredReply.isResultAvailable());
+    QVERIFY(!deferredReply.isSuccessful());
+    QCOMPARE(helper.pendingReplyCount(), 0);
+    QCOMPARE(errorSpy.count(), 1);
+    QCOMPARE(errorSpy.at(0).at(0).value<QIfAbstractFeature::Error>(), QIfAbstractFeature::Unknown);
+
+    // Reconnecting resets the error
+    helper.onReplicaStateChanged(QRemoteObjectReplica::Valid, QRemoteObjectReplica::Suspect);
+    QCOMPARE(errorSpy.count(), 2);
+    QCOMPARE(errorSpy.at(1).at(0).value<QIfAbstractFeature::Error>(), QIfAbstractFeature::NoError);
+}
+
+void tst_QIfRemoteObjectsHelper::testReplicaHelperMaximumPendingReplies()
+{
+    QIfRemoteObjectsReplicaHelper helper;
+    QCOMPARE(helper.maximumPendingReplies(), 1024);
+    helper.setMaximumPendingReplies(2);
+
+    // The oldest reply is dropped, no matter whether it still waits for the call or the result
+    QIfPendingReply<int> deferredReply = helper.toQIfPendingReply<int>(deferredCall(1));
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(helper.pendingReplyCount(), 1);
+    QIfPendingReply<int> reply = helper.toQIfPendingReply<int>(unansweredCall());
+    QCOMPARE(helper.pendingReplyCount(), 2);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(u"More than 2 remote calls are pending"_s));
+    QIfPendingReply<int> newReply = helper.toQIfPendingReply<int>(unansweredCall());
+    QCOMPARE(helper.pendingReplyCount(), 2);
+    QCOMPARE(helper.droppedReplyCount(), quint64(1));
+    QVERIFY(deferredReply.isResultAvailable());
+    QVERIFY(!deferredReply.isSuccessful());
+    QVERIFY(!reply.isResultAvailable());
+    QVERIFY(!newReply.isResultAvailable());
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(u"More than 2 remote calls are pending"_s));
+    QIfPendingReply<int> lastReply = helper.toQIfPendingReply<int>(unansweredCall());
+    QCOMPARE(helper.droppedReplyCount(), quint64(2));
+    QVERIFY(reply.isResultAvailable());
+    QVERIFY(!reply.isSuccessful());
+    QVERIFY(!newReply.isResultAvailable());
+    QVERIFY(!lastReply.isResultAvailable());
+
+    // A value of -1 disables the limit
+    helper.setMaximumPendingReplies(-1);
+    for (int i = 0; i < 5; ++i)
+        helper.toQIfPendingReply<int>(unansweredCall());
+    QCOMPARE(helper.pendingReplyCount(), 7);
+    QCOMPARE(helper.droppedReplyCount(), quint64(2));
+}
+
+void tst_QIfRemoteObjectsHelper::testReplicaHelperServiceSettings()
+{
+    QIfRemoteObjectsReplicaHelper helper;
+    const QVariantMap settings = {
+        { u"callTimeout"_s, 100 },
+        { u"maximumPendingReplies"_s, 5 },
+        { u"org.example.echomodule"_s, QVariantMap({ { u"callTimeout"_s, 300 },
+                                                     { u"maximumPendingReplies"_s, 7 } }) },
+        { u"org.example.echomodule.Echo"_s, QVariantMap({ { u"callTimeout"_s, 200 } }) },
+    };
+
+    // The first lookup key which contains a setting wins
+    helper.applyServiceSettings(settings, { u"org.example.echomodule.Echo"_s, u"org.example.echomodule"_s });
+    QCOMPARE(helper.callTimeout(), 200);
+    QCOMPARE(helper.maximumPendingReplies(), 7);
+
+    helper.applyServiceSettings(settings, { u"org.example.echomodule"_s, u"org.example.echomodule.Echo"_s });
+    QCOMPARE(helper.callTimeout(), 300);
+    QCOMPARE(helper.maximumPendingReplies(), 7);
+
+    // Without a matching key the global settings are used
+    helper.applyServiceSettings(settings, { u"org.example.other"_s });
+    QCOMPARE(helper.callTimeout(), 100);
+    QCOMPARE(helper.maximumPendingReplies(), 5);
+
+    // and without any setting the defaults
+    helper.applyServiceSettings(QVariantMap(), { u"org.example.echomodule.Echo"_s });
+    QCOMPARE(helper.callTimeout(), -1);
+    QCOMPARE(helper.maximumPendingReplies(), 1024);
+}
+
+void tst_QIfRemoteObjectsHelper::testLazyHost_data()
+{
+    QTest::addColumn<QUrl>("url");
+    QTest::newRow("local") << QUrl(u"local:tst_qifremoteobjectshelper_lazy"_s);
+    QTest::newRow("tcp") << QUrl(u"tcp://127.0.0.1:65213"_s);
+}
+
+void tst_QIfRemoteObjectsHelper::testLazyHost()
+{
+    QFETCH(QUrl, url);
+    const QString lookupName = u"testModel"_s;
+
+    TestPagingModelBackend backend;
+    std::unique_ptr<QIfPagingModelQtRoAdapter> adapter;
+    int factoryCount = 0;
+
+    QIfRemoteObjectsLazyHost host(url);
+    host.addSourceFactory([&](QRemoteObjectHostBase *node) {
+        factoryCount++;
+        adapter.reset(new QIfPagingModelQtRoAdapter(lookupName, &backend));
+        adapter->enableRemoting(node);
+    });
+    QVERIFY2(host.listen(), qPrintable(host.errorString()));
+    QVERIFY(host.isListening());
+
+    // Nothing is created before the first client connects
+    QCOMPARE(factoryCount, 0);
+    QVERIFY(!host.sourcesCreated());
+
+    QRemoteObjectNode client;
+    QVERIFY(client.connectToNode(url));
+    QScopedPointer<QIfPagingModelReplica> replica(client.acquire<QIfPagingModelReplica>(lookupName));
+    QVERIFY(replica->waitForSource());
+    QCOMPARE(replica->state(), QRemoteObjectReplica::Valid);
+    QCOMPARE(factoryCount, 1);
+    QVERIFY(host.sourcesCreated());
+
+    // The source is usable like any other source
+    replica->fetchData(QUuid(), 0, 1);
+    QTRY_COMPARE(backend.m_fetchCount, 1);
+
+    // A second client reuses the existing sources
+    QRemoteObjectNode secondClient;
+    QVERIFY(secondClient.connectToNode(url));
+    QScopedPointer<QIfPagingModelReplica> secondReplica(secondClient.acquire<QIfPagingModelReplica>(lookupName));
+    QVERIFY(secondReplica->waitForSource());
+    QCOMPARE(secondReplica->state(), QRemoteObjectReplica::Valid);
+    QCOMPARE(factoryCount, 1);
+
+    // Factories added afterwards are called right away
+    bool lateFactoryCalled = false;
+    host.addSourceFactory([&](QRemoteObjectHostBase *node) {
+        lateFactoryCalled = true;
+        QCOMPARE(node, host.host());
+    });
+    QVERIFY(lateFactoryCalled);
+    QCOMPARE(factoryCount, 1);
+
+    adapter->disableRemoting();
+}
+
+void tst_QIfRemoteObjectsHelper::testLazyHostStaleSocket()
+{
+#ifndef Q_OS_UNIX
+    QSKIP("Only unix domain sockets leave a socket file behind");
+#else
+    // A crashed server leaves the socket file behind, which blocks listening on it
+    const QString name = u"tst_qifremoteobjectshelper_stale"_s;
+    QFile staleSocket(QDir::temp().absoluteFilePath(name));
+    QVERIFY(staleSocket.open(QIODevice::WriteOnly));
+    staleSocket.close();
+
+    QLocalServer server;
+    QVERIFY(!server.listen(name));
+
+    // The lazy host removes it and listens anyway, like QRemoteObjectHost
+    const QUrl url(u"local:"_s + name);
+    TestPagingModelBackend backend;
+    std::unique_ptr<QIfPagingModelQtRoAdapter> adapter;
+    QIfRemoteObjectsLazyHost host(url);
+    host.addSourceFactory([&](QRemoteObjectHostBase *node) {
+        adapter.reset(new QIfPagingModelQtRoAdapter(u"testModel"_s, &backend));
+        adapter->enableRemoting(node);
+    });
+    QVERIFY2(host.listen(), qPrintable(host.errorString()));
+
+    QRemoteObjectNode client;
+    QVERIFY(client.connectToNode(url));
+    QScopedPointer<QIfPagingModelReplica> replica(client.acquire<QIfPagingModelReplica>(u"testModel"_s));
+    QVERIFY(replica->waitForSource());
+    QVERIFY(host.sourcesCreated());
+
+    adapter->disableRemoting();
+#endif
+}
+
+void tst_QIfRemoteObjectsHelper::testLazyHostUnsupportedScheme()
+{
+    QIfRemoteObjectsLazyHost host(QUrl(u"foo://bar"_s));
+    QVERIFY(!host.listen());
+    QVERIFY(!host.isListening());
+    QCOMPARE(host.errorString(), u"The scheme 'foo' is not supported"_s);
+}
+
+QTEST_MAIN(tst_QIfRemoteObjectsHelper)
+
+#include "tst_qifremoteobjectshelper.moc"
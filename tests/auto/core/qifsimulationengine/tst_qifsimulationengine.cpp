@@ -11,6 +11,8 @@
 #include <QQmlComponent>
 #include <QScopedPointer>
 #include <QJsonDocument>
+#include <QCborValue>
+#include <QTemporaryDir>
 
 #include <private/qifsimulationglobalobject_p.h>
 
@@ -220,6 +222,7 @@ private Q_SLOTS:
     void testOverrideEnvVariables();
     void testLoadSimulationData_data();
     void testLoadSimulationData();
+    void testLoadCborSimulationData();
 
     //QML integration
     void testPropertyRead_data();
@@ -246,6 +249,9 @@ private Q_SLOTS:
     void testCallingBaseFunction();
     void testRecursionPrevention();
     void testMultipleInstances();
+
+    void benchmarkFunctionCalls_data();
+    void benchmarkFunctionCalls();
 };
 
 QVariant tst_QIfSimulationEngine::parseJson(const QString &json, QString& error) const
@@ -321,6 +327,8 @@ void tst_QIfSimulationEngine::testLoadSimulationData_data()
     QTest::newRow("no such file") << "no-file.json" << QStringList("Cannot open the simulation data file no-file.json:*");
     QTest::newRow("invalid json") << ":/invalid-data.json" << QStringList({ "Error parsing the simulation data in :/invalid-data.json: unterminated array", "Error context:\n.*" });
     QTest::newRow("valid json") << ":/simple.json" << QStringList();
+    QTest::newRow("invalid cbor") << ":/invalid-data.cbor" << QStringList("Error parsing the simulation data in :/invalid-data.cbor: .*");
+    QTest::newRow("valid cbor") << ":/simple.cbor" << QStringList();
 }
 
 void tst_QIfSimulationEngine::testLoadSimulationData()
@@ -337,6 +345,38 @@ void tst_QIfSimulationEngine::testLoadSimulationData()
     QCOMPARE(globalObject->simulationData().isValid(), expectedErrors.isEmpty());
 }
 
+void tst_QIfSimulationEngine::testLoadCborSimulationData()
+{
+    QString error;
+    const QVariant data = parseJson(QStringLiteral(R"({
+        "org.qt-project.Interface1": {
+            "property": { "default": 5, "range": [0, 10] }
+        },
+        "Interface2": {
+            "property": { "default": "text" }
+        }
+    })"), error);
+    QVERIFY2(error.isEmpty(), qPrintable(error));
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QFile file(dir.filePath(QStringLiteral("data.cbor")));
+    QVERIFY(file.open(QFile::WriteOnly));
+    file.write(QCborValue(QCborKnownTags::Signature, QCborValue::fromVariant(data)).toCbor());
+    file.close();
+
+    QIfSimulationEngine engine;
+    engine.loadSimulationData(file.fileName());
+    auto globalObject = engine.rootContext()->contextProperty(QStringLiteral("IfSimulator")).value<QIfSimulationGlobalObject*>();
+
+    QCOMPARE(globalObject->findInterfaceData(QStringLiteral("org.qt-project.Interface1")), data.toMap().value(QStringLiteral("org.qt-project.Interface1")).toMap());
+    QCOMPARE(globalObject->findInterfaceData(QStringLiteral("org.qt-project.Interface2")), data.toMap().value(QStringLiteral("Interface2")).toMap());
+    QVERIFY(globalObject->findInterfaceData(QStringLiteral("Interface3")).isEmpty());
+    QVERIFY(globalObject->checkProperty(QStringLiteral("org.qt-project.Interface1"), QStringLiteral("property"), 5));
+    QVERIFY(!globalObject->checkProperty(QStringLiteral("org.qt-project.Interface1"), QStringLiteral("property"), 11));
+    QCOMPARE(globalObject->simulationData(), data);
+}
+
 void tst_QIfSimulationEngine::testPropertyRead_data()
 {
     QTest::addColumn<QByteArray>("property");
@@ -1022,6 +1062,55 @@ void tst_QIfSimulationEngine::testMultipleInstances()
     QCOMPARE(returnValueSpy.at(0), expectedValues);
 }
 
+void tst_QIfSimulationEngine::benchmarkFunctionCalls_data()
+{
+    QTest::addColumn<bool>("implementedInQml");
+    QTest::newRow("implemented in QML") << true;
+    QTest::newRow("not implemented in QML") << false;
+}
+
+void tst_QIfSimulationEngine::benchmarkFunctionCalls()
+{
+    QFETCH(bool, implementedInQml);
+
+    QIfSimulationEngine engine;
+
+    SimpleTestAPI testObject;
+    engine.registerSimulationInstance<SimpleTestAPI>(&testObject, "TestAPI", 1, 0, "SimpleTestAPI");
+
+    QByteArray qml ("import QtQuick; \n\
+                     import TestAPI; \n\
+                     SimpleTestAPI { \n\
+                        function functionWithReturnValue(intArgument) { \n\
+                            return intArgument; \n\
+                        } \n\
+                     }");
+    if (!implementedInQml)
+        qml = "import TestAPI; SimpleTestAPI {}";
+
+    QQmlComponent component(&engine);
+    component.setData(qml, QUrl());
+    QScopedPointer<QObject> obj(component.create());
+    QVERIFY2(obj, qPrintable(component.errorString()));
+
+    const int callCount = 10000;
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+    int iterations = 0;
+    QBENCHMARK {
+        timer.start();
+        for (int i = 0; i < callCount; i++)
+            testObject.functionWithReturnValue(i);
+        elapsed += timer.nsecsElapsed();
+        iterations++;
+    }
+
+    if (elapsed)
+        qInfo() << "Calls per second:" << qint64(iterations) * callCount * 1000000000 / elapsed;
+
+    QCOMPARE(testObject.m_callCounter, implementedInQml ? 0 : callCount * iterations);
+}
+
 QTEST_MAIN(tst_QIfSimulationEngine)
 
 #include "tst_qifsimulationengine.moc"
@@ -230,6 +230,10 @@ private Q_SLOTS:
     void testConstraint_data();
     void testConstraint();
     void testConstraintInvalid();
+    void testCheckProperty_data();
+    void testCheckProperty();
+    void testPropertyConstraint_data();
+    void testPropertyConstraint();
 };
 
 QVariant tst_QIfSimulationGlobalObject::parseJson(const QString &json, QString& error) const
@@ -532,6 +536,56 @@ void tst_QIfSimulationGlobalObject::testConstraintInvalid()
     QVERIFY(result.isEmpty());
 }
 
+void tst_QIfSimulationGlobalObject::testCheckProperty_data()
+{
+    testCheckSettings_data();
+}
+
+void tst_QIfSimulationGlobalObject::testCheckProperty()
+{
+    QFETCH(QString, json);
+    QFETCH(QString, zone);
+    QFETCH(QVariant, value);
+    QFETCH(bool, expectedResult);
+
+    QIfSimulationGlobalObject globalObject;
+
+    QString error;
+    QVariant data = parseJson(QString("{ \"ClimateControl\": { \"property\": %1 } }").arg(json), error);
+    QVERIFY2(error.isEmpty(), qPrintable(error));
+    globalObject.setSimulationData(data);
+
+    QCOMPARE(globalObject.checkProperty("org.qt-project.ClimateControl", "property", value, zone), expectedResult);
+    // The result for the data based lookup needs to be the same
+    QCOMPARE(globalObject.checkSettings(globalObject.findData(data.toMap(), "ClimateControl").value("property").toMap(), value, zone), expectedResult);
+
+    // Properties and interfaces without data don't have any constraint
+    QVERIFY(globalObject.checkProperty("org.qt-project.ClimateControl", "otherProperty", value, zone));
+    QVERIFY(globalObject.checkProperty("AddressBook", "property", value, zone));
+}
+
+void tst_QIfSimulationGlobalObject::testPropertyConstraint_data()
+{
+    testConstraint_data();
+}
+
+void tst_QIfSimulationGlobalObject::testPropertyConstraint()
+{
+    QFETCH(QString, json);
+    QFETCH(QString, zone);
+    QFETCH(QString, expectedResult);
+
+    QIfSimulationGlobalObject globalObject;
+
+    QString error;
+    QVariant data = parseJson(QString("{ \"ClimateControl\": { \"property\": %1 } }").arg(json), error);
+    QVERIFY2(error.isEmpty(), qPrintable(error));
+    globalObject.setSimulationData(data);
+
+    QCOMPARE(globalObject.propertyConstraint("ClimateControl", "property", zone), expectedResult);
+    QVERIFY(globalObject.propertyConstraint("ClimateControl", "otherProperty", zone).isEmpty());
+}
+
 QTEST_MAIN(tst_QIfSimulationGlobalObject)
 
 #include "tst_qifsimulationglobalobject.moc"
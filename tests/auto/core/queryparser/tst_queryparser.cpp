@@ -6,7 +6,12 @@
 #include <QtTest/QtTest>
 #include <QtCore/QString>
 
+#include <memory>
+
+using namespace Qt::StringLiterals;
+
 #include "QtInterfaceFramework/private/qifqueryparser_p.h"
+#include "QtInterfaceFramework/private/qifqueryevaluator_p.h"
 
 // sadly this has to be a define for QVERIFY2() to work
 #define CHECK_ERRORSTRING(_actual_errstr, _expected_errstr) do { \
@@ -20,6 +25,47 @@
     } \
 } while (false)
 
+class TestItem
+{
+    Q_GADGET
+    Q_PROPERTY(QString name MEMBER m_name)
+    Q_PROPERTY(int number MEMBER m_number)
+
+public:
+    QString m_name;
+    int m_number = 0;
+};
+
+namespace {
+    QList<TestItem> createItems()
+    {
+        return {
+            { u"alpha"_s, 5 },
+            { u"Beta"_s, 3 },
+            { u"gamma"_s, 8 },
+            { u"delta"_s, 3 },
+            { u"Epsilon"_s, 1 },
+        };
+    }
+
+    QList<TestItem> createBigList()
+    {
+        QList<TestItem> list;
+        list.reserve(100000);
+        for (int i = 0; i < 100000; i++)
+            list.append({ u"item"_s + QString::number(i), (i * 7919) % 1000 });
+        return list;
+    }
+
+    QStringList names(const QList<TestItem> &list)
+    {
+        QStringList names;
+        for (const TestItem &item : list)
+            names.append(item.m_name);
+        return names;
+    }
+}
+
 class TestQueryParser: public QObject
 {
     Q_OBJECT
@@ -32,6 +78,17 @@ private slots:
     void identifierList();
     void invalidIdentifierList_data();
     void invalidIdentifierList();
+    void evaluator_data();
+    void evaluator();
+    void evaluatorOrder();
+    void evaluatorInvalidProperty();
+    void evaluatorParallel();
+    void evaluatorIndex_data();
+    void evaluatorIndex();
+    void evaluatorIndexUpdates();
+    void benchmarkEvaluator_data();
+    void benchmarkEvaluator();
+    void benchmarkIndex();
 };
 
 void TestQueryParser::validQueries_data()
@@ -227,6 +284,270 @@ void TestQueryParser::invalidIdentifierList()
     QVERIFY(!parser.lastError().isEmpty());
 }
 
+void TestQueryParser::evaluator_data()
+{
+    QTest::addColumn<QString>("query");
+    QTest::addColumn<QStringList>("expected");
+
+    QTest::newRow("=") << "number=3" << QStringList({ "Beta", "delta" });
+    QTest::newRow("!=") << "number!=3" << QStringList({ "alpha", "gamma", "Epsilon" });
+    QTest::newRow(">") << "number>3" << QStringList({ "alpha", "gamma" });
+    QTest::newRow(">=") << "number>=5" << QStringList({ "alpha", "gamma" });
+    QTest::newRow("<") << "number<3" << QStringList({ "Epsilon" });
+    QTest::newRow("<=") << "number<=3" << QStringList({ "Beta", "delta", "Epsilon" });
+    QTest::newRow("float") << "number>2.5 & number<5.5" << QStringList({ "alpha", "Beta", "delta" });
+    QTest::newRow("string") << "name='beta'" << QStringList();
+    QTest::newRow("case insensitive") << "name~='beta'" << QStringList({ "Beta" });
+    QTest::newRow("converted value") << "number='3'" << QStringList({ "Beta", "delta" });
+    QTest::newRow("or") << "number=1 | name='gamma'" << QStringList({ "gamma", "Epsilon" });
+    QTest::newRow("negation") << "!number=3" << QStringList({ "alpha", "gamma", "Epsilon" });
+    QTest::newRow("negated scope") << "!(number=3 | number=5)" << QStringList({ "gamma", "Epsilon" });
+}
+
+void TestQueryParser::evaluator()
+{
+    QFETCH(QString, query);
+    QFETCH(QStringList, expected);
+
+    QIfQueryParser parser;
+    parser.setQuery(query);
+    std::unique_ptr<QIfAbstractQueryTerm> term(parser.parse());
+    QVERIFY2(term, qPrintable(parser.lastError()));
+
+    QIfQueryEvaluator evaluator(&TestItem::staticMetaObject, term.get(), parser.orderTerms());
+    QVERIFY2(evaluator.isValid(), qPrintable(evaluator.errorString()));
+    QVERIFY(evaluator.hasFilter());
+    QVERIFY(!evaluator.hasOrder());
+
+    const QList<TestItem> items = createItems();
+    QCOMPARE(names(evaluator.filtered(items)), expected);
+
+    // Items stored in QVariants are supported as well
+    QVariantList variants;
+    for (const TestItem &item : items)
+        variants.append(QVariant::fromValue(item));
+    const QVariantList filtered = evaluator.filtered(variants);
+    QCOMPARE(filtered.count(), expected.count());
+    for (int i = 0; i < filtered.count(); i++)
+        QCOMPARE(filtered.at(i).value<TestItem>().m_name, expected.at(i));
+}
+
+void TestQueryParser::evaluatorOrder()
+{
+    QIfQueryParser parser;
+    parser.setQuery(u"number>0 [/number][\\name]"_s);
+    std::unique_ptr<QIfAbstractQueryTerm> term(parser.parse());
+    QVERIFY2(term, qPrintable(parser.lastError()));
+    QCOMPARE(parser.orderTerms().count(), 2);
+
+    QIfQueryEvaluator evaluator(&TestItem::staticMetaObject, term.get(), parser.orderTerms());
+    QVERIFY(evaluator.hasOrder());
+
+    const QStringList expected({ "Epsilon", "delta", "Beta", "alpha", "gamma" });
+    QCOMPARE(names(evaluator.apply(createItems())), expected);
+
+    // Without a filter all items are kept
+    QIfQueryEvaluator orderOnly(&TestItem::staticMetaObject, nullptr, parser.orderTerms());
+    QVERIFY(!orderOnly.hasFilter());
+    QCOMPARE(names(orderOnly.apply(createItems())), expected);
+}
+
+void TestQueryParser::evaluatorInvalidProperty()
+{
+    QIfQueryParser parser;
+    parser.setQuery(u"foo=5"_s);
+    std::unique_ptr<QIfAbstractQueryTerm> term(parser.parse());
+    QVERIFY2(term, qPrintable(parser.lastError()));
+
+    QIfQueryEvaluator evaluator(&TestItem::staticMetaObject, term.get());
+    QVERIFY(!evaluator.isValid());
+    QVERIFY(evaluator.errorString().contains(u"foo"_s));
+    QVERIFY(evaluator.filtered(createItems()).isEmpty());
+}
+
+void TestQueryParser::evaluatorParallel()
+{
+    QIfQueryParser parser;
+    parser.setQuery(u"number<500 & number!=250 [/number]"_s);
+    std::unique_ptr<QIfAbstractQueryTerm> term(parser.parse());
+    QVERIFY2(term, qPrintable(parser.lastError()));
+
+    QIfQueryEvaluator evaluator(&TestItem::staticMetaObject, term.get(), parser.orderTerms());
+    const QList<TestItem> list = createBigList();
+
+    const QList<TestItem> sequential = evaluator.apply(list, QIfQueryEvaluator::Sequential);
+    const QList<TestItem> parallel = evaluator.apply(list, QIfQueryEvaluator::Parallel);
+    QCOMPARE(sequential.count(), 49900);
+    QCOMPARE(names(parallel), names(sequential));
+    QCOMPARE(parallel.constFirst().m_number, 0);
+    QCOMPARE(parallel.constLast().m_number, 499);
+}
+
+void TestQueryParser::evaluatorIndex_data()
+{
+    QTest::addColumn<QString>("query");
+
+    QTest::newRow("=") << "number=3";
+    QTest::newRow("!=") << "number!=3";
+    QTest::newRow(">") << "number>3";
+    QTest::newRow(">=") << "number>=5";
+    QTest::newRow("<") << "number<3";
+    QTest::newRow("<=") << "number<=3";
+    QTest::newRow("float") << "number>2.5 & number<5.5";
+    QTest::newRow("converted value") << "number='3'";
+    QTest::newRow("or") << "number=1 | name='gamma'";
+    QTest::newRow("negation") << "!number=3";
+    QTest::newRow("and not indexed") << "number>=3 & name~='beta'";
+    QTest::newRow("order") << "number>0 [/number][\\name]";
+    QTest::newRow("descending order") << "number<8 [\\number][/name]";
+    QTest::newRow("order not indexed") << "number>=3 [/name]";
+    QTest::newRow("order not narrowed") << "number!=3 [\\number]";
+}
+
+void TestQueryParser::evaluatorIndex()
+{
+    QFETCH(QString, query);
+
+    QIfQueryParser parser;
+    parser.setQuery(query);
+    std::unique_ptr<QIfAbstractQueryTerm> term(parser.parse());
+    QVERIFY2(parser.lastError().isEmpty(), qPrintable(parser.lastError()));
+
+    QIfQueryEvaluator evaluator(&TestItem::staticMetaObject, term.get(), parser.orderTerms());
+    QVERIFY2(evaluator.isValid(), qPrintable(evaluator.errorString()));
+
+    // The name is not part of the index, to cover filters which need to be checked for every item
+    QIfQueryIndex index(&TestItem::staticMetaObject, { u"number"_s, u"foo"_s });
+    QCOMPARE(index.properties(), QStringList({ u"number"_s }));
+
+    const QList<TestItem> items = createItems();
+    index.reset(items);
+    QCOMPARE(index.count(), items.count());
+    QCOMPARE(names(evaluator.apply(items, index)), names(evaluator.apply(items)));
+
+    const QList<TestItem> list = createBigList();
+    index.reset(list);
+    QCOMPARE(names(evaluator.apply(list, index)), names(evaluator.apply(list)));
+}
+
+void TestQueryParser::evaluatorIndexUpdates()
+{
+    QIfQueryParser parser;
+    parser.setQuery(u"number>=3 [/number]"_s);
+    std::unique_ptr<QIfAbstractQueryTerm> term(parser.parse());
+    QVERIFY2(term, qPrintable(parser.lastError()));
+
+    QIfQueryEvaluator evaluator(&TestItem::staticMetaObject, term.get(), parser.orderTerms());
+    QIfQueryIndex index(&TestItem::staticMetaObject, { u"number"_s, u"name"_s });
+
+    QList<TestItem> items = createItems();
+    index.reset(items);
+    QCOMPARE(names(evaluator.apply(items, index)), QStringList({ "Beta", "delta", "alpha", "gamma" }));
+
+    const TestItem inserted { u"zeta"_s, 3 };
+    items.insert(1, inserted);
+    index.insert(1, inserted);
+    QCOMPARE(names(evaluator.apply(items, index)), QStringList({ "zeta", "Beta", "delta", "alpha", "gamma" }));
+
+    items.removeAt(2);
+    index.remove(2);
+    QCOMPARE(names(evaluator.apply(items, index)), QStringList({ "zeta", "delta", "alpha", "gamma" }));
+
+    items.move(3, 0);
+    index.move(3, 0);
+    QCOMPARE(names(evaluator.apply(items, index)), QStringList({ "delta", "zeta", "alpha", "gamma" }));
+
+    items.move(0, 4);
+    index.move(0, 4);
+    QCOMPARE(names(evaluator.apply(items, index)), QStringList({ "zeta", "delta", "alpha", "gamma" }));
+
+    items[0].m_number = 10;
+    index.update(0, items.at(0));
+    QCOMPARE(names(evaluator.apply(items, index)), QStringList({ "zeta", "delta", "gamma", "alpha" }));
+    QCOMPARE(names(evaluator.apply(items, index)), names(evaluator.apply(items)));
+
+    // Items stored in QVariants are supported as well
+    QVariantList variants;
+    for (const TestItem &item : std::as_const(items))
+        variants.append(QVariant::fromValue(item));
+    index.reset(variants);
+    const QVariantList filtered = evaluator.apply(variants, index);
+    QCOMPARE(filtered.count(), 4);
+    for (int i = 0; i < filtered.count(); i++)
+        QCOMPARE(filtered.at(i).value<TestItem>().m_name, evaluator.apply(items).at(i).m_name);
+
+    // Items of a foreign type are never read and only kept without a filter
+    variants.insert(1, QVariant(42));
+    variants.append(QVariant(u"foo"_s));
+    index.reset(variants);
+    QCOMPARE(evaluator.apply(variants, index).count(), 4);
+    index.insert(0, QVariant(3));
+    variants.insert(0, QVariant(3));
+    index.update(3, QVariant());
+    variants[3] = QVariant();
+    QCOMPARE(evaluator.apply(variants, index).count(), 3);
+
+    QIfQueryEvaluator orderOnly(&TestItem::staticMetaObject, nullptr, parser.orderTerms());
+    const QVariantList ordered = orderOnly.apply(variants, index);
+    const QVariantList expectedOrder = orderOnly.apply(variants);
+    QCOMPARE(ordered.count(), variants.count());
+    for (int i = 0; i < ordered.count(); i++) {
+        QCOMPARE(ordered.at(i).metaType(), expectedOrder.at(i).metaType());
+        if (ordered.at(i).canConvert<TestItem>())
+            QCOMPARE(ordered.at(i).value<TestItem>().m_name, expectedOrder.at(i).value<TestItem>().m_name);
+    }
+    QCOMPARE(ordered.constLast(), QVariant(u"foo"_s));
+
+    index.clear();
+    QCOMPARE(index.count(), 0);
+    QVERIFY(evaluator.apply(QList<TestItem>(), index).isEmpty());
+}
+
+void TestQueryParser::benchmarkEvaluator_data()
+{
+    QTest::addColumn<bool>("parallel");
+
+    QTest::newRow("sequential") << false;
+    QTest::newRow("parallel") << true;
+}
+
+void TestQueryParser::benchmarkEvaluator()
+{
+    QFETCH(bool, parallel);
+    const auto policy = parallel ? QIfQueryEvaluator::Parallel : QIfQueryEvaluator::Sequential;
+
+    QIfQueryParser parser;
+    parser.setQuery(u"number>=100 & name!='item5' [\\number][/name]"_s);
+    std::unique_ptr<QIfAbstractQueryTerm> term(parser.parse());
+    QVERIFY2(term, qPrintable(parser.lastError()));
+
+    QIfQueryEvaluator evaluator(&TestItem::staticMetaObject, term.get(), parser.orderTerms());
+    const QList<TestItem> list = createBigList();
+
+    QBENCHMARK {
+        const QList<TestItem> result = evaluator.apply(list, policy);
+        QVERIFY(!result.isEmpty());
+    }
+}
+
+void TestQueryParser::benchmarkIndex()
+{
+    QIfQueryParser parser;
+    parser.setQuery(u"number>=100 & number<200 & name!='item5' [\\number][/name]"_s);
+    std::unique_ptr<QIfAbstractQueryTerm> term(parser.parse());
+    QVERIFY2(term, qPrintable(parser.lastError()));
+
+    QIfQueryEvaluator evaluator(&TestItem::staticMetaObject, term.get(), parser.orderTerms());
+    const QList<TestItem> list = createBigList();
+    QIfQueryIndex index(&TestItem::staticMetaObject, { u"number"_s, u"name"_s });
+    index.reset(list);
+
+    QBENCHMARK {
+        const QList<TestItem> result = evaluator.apply(list, index);
+        QVERIFY(!result.isEmpty());
+    }
+}
+
 //TODO add autotests for the orderTerms
 
 QTEST_MAIN(TestQueryParser)
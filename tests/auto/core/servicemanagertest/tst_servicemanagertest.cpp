@@ -3,6 +3,9 @@
 // Copyright (C) 2018 Pelagicore AG
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 
+#include <QCborArray>
+#include <QCborMap>
+#include <QJsonArray>
 #include <QString>
 #include <QtTest>
 #include <QQmlEngine>
@@ -14,6 +17,8 @@
 #include <QIfProxyServiceObject>
 #include <private/qifproxyserviceobject_p.h>
 
+using namespace Qt::StringLiterals;
+
 class MockServiceBackend : public QObject, public QIfServiceInterface
 {
     Q_OBJECT
@@ -77,6 +82,7 @@ public:
 
     void ignoreStaticPluginWarnings();
     void ignoreDynamicPluginWarnings();
+    void reloadPluginIndex();
 
 private Q_SLOTS:
     void initTestCase();
@@ -94,10 +100,12 @@ private Q_SLOTS:
     void testLoadServiceObjectsQML();
     void testSyncAfterAsyncLoading();
     void testPreferredBackends();
+    void testReplacedBackend();
     void testRegisterWithNoInterfaces();
     void testRegisterNonServiceBackendInterfaceObject();
     void testManagerListModel();
     void pluginLoaderTest();
+    void testPluginIndex();
 
 private:
     QIfServiceManager *manager;
@@ -127,8 +135,66 @@ void ServiceManagerTest::ignoreDynamicPluginWarnings()
 #endif
 }
 
+void ServiceManagerTest::reloadPluginIndex()
+{
+    // Forget about the index, to read it again like on the next start of the application
+    auto *d = QIfServiceManagerPrivate::get(manager);
+    d->m_pluginIndexLoaded = false;
+    d->m_pluginIndexDirty = false;
+    d->m_pluginIndex = QCborMap();
+    d->m_pluginIndexFile.clear();
+
+    cleanup();
+}
+
+// Replaces the interfaces of the simple_plugin within the plugin index by "indexed_plugin". This
+// makes it visible whether the metaData is taken from the index or from the plugin itself.
+static void modifyPluginIndex(const QString &fileName, bool keepStamp)
+{
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QCborMap index = QCborValue::fromCbor(file.readAll()).toMap();
+    file.close();
+
+    QCborMap directories = index.value(u"directories"_s).toMap();
+    QVERIFY(!directories.isEmpty());
+    for (auto dirIt = directories.begin(); dirIt != directories.end(); ++dirIt) {
+        QCborMap directory = dirIt.value().toMap();
+        QCborMap files = directory.value(u"files"_s).toMap();
+        for (auto fileIt = files.begin(); fileIt != files.end(); ++fileIt) {
+            QCborMap entry = fileIt.value().toMap();
+            QJsonObject metaData = entry.value(u"MetaData"_s).toJsonValue().toObject();
+            QJsonObject backendMetaData = metaData.value(u"MetaData"_s).toObject();
+            if (!backendMetaData.value(u"interfaces"_s).toArray().contains(u"simple_plugin"_s))
+                continue;
+
+            backendMetaData.insert(u"interfaces"_s, QJsonArray({ u"indexed_plugin"_s }));
+            metaData.insert(u"MetaData"_s, backendMetaData);
+            entry.insert(u"MetaData"_s, QCborValue::fromJsonValue(metaData));
+            if (!keepStamp)
+                entry.insert(u"stamp"_s, QCborArray({ 0, 0, 0 }));
+            fileIt.value() = entry;
+        }
+        directory.insert(u"files"_s, files);
+        dirIt.value() = directory;
+    }
+    index.insert(u"directories"_s, directories);
+
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QVERIFY(file.write(index.toCborValue().toCbor()) != -1);
+}
+
+static bool pluginIndexContains(const QString &fileName, const QByteArray &data)
+{
+    QFile file(fileName);
+    return file.open(QIODevice::ReadOnly) && file.readAll().contains(data);
+}
+
 void ServiceManagerTest::initTestCase()
 {
+    // Don't touch the plugin index of the real cache location
+    QStandardPaths::setTestModeEnabled(true);
+
     QStringList defaultLibraryPath = QCoreApplication::libraryPaths();
     // Make sure the dynamic plugins can't be found in the beginning
     QCoreApplication::setLibraryPaths(QStringList());
@@ -436,6 +502,56 @@ void ServiceManagerTest::testPreferredBackends()
     QCOMPARE(foundBackends.count(), 2);
 }
 
+/*
+    Test that the interface lookup returns the remaining backend, once a plugin was found in a
+    debug and a release configuration
+*/
+void ServiceManagerTest::testReplacedBackend()
+{
+    auto *d = QIfServiceManagerPrivate::get(manager);
+    const int backendCount = manager->rowCount();
+
+#ifdef Q_OS_WIN
+    const QString fileTemplate = u"%1%2.dll"_s;
+    const QString debugSuffix = u"d"_s;
+#else
+    const QString fileTemplate = u"lib%1%2.so"_s;
+    const QString debugSuffix = u"_debug"_s;
+#endif
+    auto fileName = [&](const QString &plugin, bool debug) {
+        return fileTemplate.arg(plugin, debug ? debugSuffix : QString());
+    };
+    auto metaData = [](const QString &interface, bool debug) {
+        return QJsonObject {
+            { u"className"_s, interface },
+            { u"debug"_s, debug },
+            { u"MetaData"_s, QJsonObject { { u"interfaces"_s, QJsonArray { interface } } } }
+        };
+    };
+
+    // Only one of the configurations is kept, the one which matches the configuration of the
+    // library. Registering in both orders makes sure one of them replaces the registered backend.
+    d->registerBackend(fileName(u"replaced_plugin"_s, false), metaData(u"replaced_interface"_s, false));
+    d->registerBackend(fileName(u"replaced_plugin"_s, true), metaData(u"replaced_interface"_s, true));
+    d->registerBackend(fileName(u"replaced_plugin2"_s, true), metaData(u"replaced_interface2"_s, true));
+    d->registerBackend(fileName(u"replaced_plugin2"_s, false), metaData(u"replaced_interface2"_s, false));
+    QCOMPARE(manager->rowCount(), backendCount + 2);
+
+    const QList<QIfServiceObjectHandle> handles = manager->findServiceHandleByInterface(u"replaced_interface"_s);
+    QCOMPARE(handles.count(), 1);
+    const QList<QIfServiceObjectHandle> handles2 = manager->findServiceHandleByInterface(u"replaced_interface2"_s);
+    QCOMPARE(handles2.count(), 1);
+
+    // Both lookups return a backend of the same configuration, which is still registered
+    auto *backend = d->m_interfaceIndex.value(u"replaced_interface"_s).constFirst();
+    auto *backend2 = d->m_interfaceIndex.value(u"replaced_interface2"_s).constFirst();
+    QVERIFY(d->m_backends.contains(backend));
+    QVERIFY(d->m_backends.contains(backend2));
+    QCOMPARE(backend->debug, backend2->debug);
+    QCOMPARE(backend->metaData.value(u"fileName"_s).toString(), fileName(u"replaced_plugin"_s, backend->debug));
+    QCOMPARE(backend2->metaData.value(u"fileName"_s).toString(), fileName(u"replaced_plugin2"_s, backend2->debug));
+}
+
 /*
     Test that the registerService method returns false if the user tries
     to register a service with an empty list of interfaces.
@@ -524,6 +640,58 @@ void ServiceManagerTest::testManagerListModel()
     QCOMPARE(managerModelSpy.count(), 3);
 }
 
+void ServiceManagerTest::testPluginIndex()
+{
+#ifdef Q_OS_ANDROID
+    QSKIP("The plugins can't be modified on android");
+#endif
+    auto *d = QIfServiceManagerPrivate::get(manager);
+    const QString indexFile = d->m_pluginIndexFile;
+    QVERIFY(!indexFile.isEmpty());
+    QVERIFY(QFile::exists(indexFile));
+    QVERIFY(manager->hasInterface(u"simple_plugin"_s));
+
+    // The metaData of unchanged plugins is taken from the index
+    modifyPluginIndex(indexFile, true);
+    reloadPluginIndex();
+    QVERIFY(manager->hasInterface(u"indexed_plugin"_s));
+    QVERIFY(!manager->hasInterface(u"simple_plugin"_s));
+
+    // The index entry doesn't match the plugin anymore. The plugin is scanned again and the
+    // index is updated.
+    modifyPluginIndex(indexFile, false);
+    reloadPluginIndex();
+    QVERIFY(!manager->hasInterface(u"indexed_plugin"_s));
+    QVERIFY(manager->hasInterface(u"simple_plugin"_s));
+    QVERIFY(!pluginIndexContains(indexFile, "indexed_plugin"));
+
+    // An invalid index is ignored and replaced
+    {
+        QFile file(indexFile);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write("not a plugin index");
+    }
+    reloadPluginIndex();
+    QVERIFY(manager->hasInterface(u"simple_plugin"_s));
+    QVERIFY(!pluginIndexContains(indexFile, "not a plugin index"));
+    QVERIFY(pluginIndexContains(indexFile, "simple_plugin"));
+
+    // Disabling the index ignores it and doesn't write it either
+    modifyPluginIndex(indexFile, true);
+    qputenv("QTIF_DISABLE_PLUGIN_INDEX", "1");
+    reloadPluginIndex();
+    qunsetenv("QTIF_DISABLE_PLUGIN_INDEX");
+    QVERIFY(!manager->hasInterface(u"indexed_plugin"_s));
+    QVERIFY(manager->hasInterface(u"simple_plugin"_s));
+    QVERIFY(pluginIndexContains(indexFile, "indexed_plugin"));
+    QVERIFY(d->m_pluginIndexFile.isEmpty());
+
+    // Restore a valid index for the following tests
+    modifyPluginIndex(indexFile, false);
+    reloadPluginIndex();
+    QVERIFY(manager->hasInterface(u"simple_plugin"_s));
+}
+
 void ServiceManagerTest::pluginLoaderTest()
 {
     QVERIFY(manager->hasInterface("simple_plugin"));